@@ -1,5 +1,6 @@
 /* See LICENSE file for copyright and license details. */
 #include <errno.h>
+#include <math.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -9,13 +10,486 @@
 #include "../grapheme.h"
 #include "util.h"
 
-#define NUM_ITERATIONS 100000
+#define NUM_ITERATIONS      100
+#define NUM_TEST_ITERATIONS 10
+#define NUM_CODEPOINTS      5000
+#define NUM_COLUMNS         80
+
+struct bidirectional_benchmark_payload {
+	uint_least32_t *src;
+	size_t srclen;
+	size_t *len;
+	enum grapheme_bidirectional_direction *mode;
+	size_t count;
+	uint_least32_t *data;
+	uint_least32_t *links;
+	int_least8_t *lev;
+	uint_least32_t *output;
+	size_t *map;
+	struct grapheme_bidirectional_line *line;
+	struct grapheme_bidirectional_run *run;
+	uint_least16_t *compact;
+};
+
+enum text_type {
+	TEXT_LTR,
+	TEXT_RTL,
+	TEXT_MIXED,
+	TEXT_ISOLATES,
+	TEXT_NESTED_ISOLATES,
+	TEXT_EMBEDDINGS,
+	TEXT_BRACKETS,
+	TEXT_UNCLOSED_BRACKETS,
+	NUM_TEXT_TYPES,
+};
+
+static const char *text_type_name[] = {
+	[TEXT_LTR] = "pure LTR",
+	[TEXT_RTL] = "pure RTL",
+	[TEXT_MIXED] = "mixed Arabic/English with numbers",
+	[TEXT_ISOLATES] = "deeply nested isolates",
+	[TEXT_NESTED_ISOLATES] = "hundreds of nested isolates",
+	[TEXT_EMBEDDINGS] = "deeply nested embeddings",
+	[TEXT_BRACKETS] = "bracket-heavy",
+	[TEXT_UNCLOSED_BRACKETS] = "thousands of brackets",
+};
+
+static void
+libgrapheme_is_trivial(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_is_trivial(p->src + off,
+		                                         p->len[i]);
+	}
+}
+
+static void
+libgrapheme_preprocess(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_preprocess_paragraph_links(
+			p->src + off, p->len[i], p->mode[i], p->data + off,
+			p->len[i], p->links + off, NULL);
+	}
+}
+
+static void
+libgrapheme_line_levels(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_get_line_embedding_levels(
+			p->data + off, p->len[i], p->lev + off, p->len[i]);
+	}
+}
+
+static void
+libgrapheme_reorder(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	/* the output buffer has to be larger than the line */
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_reorder_line(
+			p->src + off, p->data + off, p->len[i],
+			p->output + off, p->len[i] + 1);
+	}
+}
+
+static void
+libgrapheme_reorder_map(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_reorder_line_map(
+			p->data + off, p->len[i], p->map + off, p->len[i],
+			NULL, 0);
+	}
+}
+
+static void
+libgrapheme_layout(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	/* there are at most as many lines and runs as codepoints */
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_layout_paragraph(
+			p->src + off, p->len[i], p->mode[i], NUM_COLUMNS,
+			p->data + off, p->len[i], p->line + off, p->len[i],
+			NULL, p->run + off, p->len[i], NULL);
+	}
+}
+
+static void
+libgrapheme_preprocess_compact(const void *payload)
+{
+	const struct bidirectional_benchmark_payload *p = payload;
+	size_t i, off;
+
+	/* the scratch buffer is left with the same states as before */
+	for (i = 0, off = 0; i < p->count; off += p->len[i], i++) {
+		(void)grapheme_bidirectional_preprocess_document_compact(
+			p->src + off, p->len[i], p->mode[i], p->compact + off,
+			p->len[i], p->data + off, p->len[i], NULL, NULL, 0,
+			NULL);
+	}
+}
+
+static int
+allocate_payload(struct bidirectional_benchmark_payload *p, size_t srclen,
+                 size_t count)
+{
+	p->srclen = srclen;
+	p->count = count;
+
+	/* the level and output buffers have one spare entry at the end */
+	if ((p->src = calloc(srclen, sizeof(*(p->src)))) == NULL ||
+	    (p->len = calloc(count, sizeof(*(p->len)))) == NULL ||
+	    (p->mode = calloc(count, sizeof(*(p->mode)))) == NULL ||
+	    (p->data = calloc(srclen, sizeof(*(p->data)))) == NULL ||
+	    (p->links = calloc(srclen, sizeof(*(p->links)))) == NULL ||
+	    (p->lev = calloc(srclen + 1, sizeof(*(p->lev)))) == NULL ||
+	    (p->output = calloc(srclen + 1, sizeof(*(p->output)))) == NULL ||
+	    (p->map = calloc(srclen, sizeof(*(p->map)))) == NULL ||
+	    (p->line = calloc(srclen, sizeof(*(p->line)))) == NULL ||
+	    (p->run = calloc(srclen, sizeof(*(p->run)))) == NULL ||
+	    (p->compact = calloc(srclen, sizeof(*(p->compact)))) == NULL) {
+		fprintf(stderr, "calloc: Out of memory\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+static void
+free_payload(struct bidirectional_benchmark_payload *p)
+{
+	free(p->src);
+	free(p->len);
+	free(p->mode);
+	free(p->data);
+	free(p->links);
+	free(p->lev);
+	free(p->output);
+	free(p->map);
+	free(p->line);
+	free(p->run);
+	free(p->compact);
+}
+
+static int
+generate_test_paragraphs(struct bidirectional_benchmark_payload *p)
+{
+	size_t i, j, srclen;
+
+	/* each test is a paragraph of its own in the first mode it lists */
+	for (i = 0, srclen = 0; i < LEN(bidirectional_test); i++) {
+		srclen += bidirectional_test[i].cplen;
+	}
+	if (allocate_payload(p, srclen, LEN(bidirectional_test))) {
+		return 1;
+	}
+	for (i = 0, srclen = 0; i < LEN(bidirectional_test); i++) {
+		for (j = 0; j < bidirectional_test[i].cplen; j++) {
+			p->src[srclen++] = bidirectional_test[i].cp[j];
+		}
+		p->len[i] = bidirectional_test[i].cplen;
+		p->mode[i] = bidirectional_test[i].mode[0];
+	}
+
+	return 0;
+}
+
+static uint_least32_t
+pick(uint_least32_t *state, const uint_least32_t *cp, size_t cplen)
+{
+	*state = *state * 1103515245 + 12345;
+
+	return cp[(*state >> 16) % cplen];
+}
+
+static int
+generate_paragraph(struct bidirectional_benchmark_payload *p,
+                   enum text_type type)
+{
+	static const uint_least32_t latin[] = {
+		'a', 'b', 'e', 'i', 'l', 'n', 'o', 's', 't', 'A', 'T',
+	};
+	static const uint_least32_t hebrew[] = {
+		0x05D0, 0x05D1, 0x05D3, 0x05D4, 0x05D5,
+		0x05DC, 0x05DD, 0x05E9, 0x05EA,
+	};
+	static const uint_least32_t arabic[] = {
+		0x0627, 0x0628, 0x062A, 0x0644, 0x0645, 0x0646, 0x064A,
+	};
+	static const uint_least32_t digit[] = {
+		'0', '1', '2', '5', '9', 0x0661, 0x0662, 0x0665,
+	};
+	static const uint_least32_t separator[] = {
+		'.', ',', ':', '/', '-', '+', '%',
+	};
+	static const uint_least32_t open_bracket[] = {
+		'(', '[', '{', 0x2329, 0x3008,
+	};
+	static const uint_least32_t isolate[] = {
+		0x2066, /* LEFT-TO-RIGHT ISOLATE */
+		0x2067, /* RIGHT-TO-LEFT ISOLATE */
+		0x2068, /* FIRST STRONG ISOLATE */
+	};
+	uint_least32_t state = 1, cp, stack[32];
+	size_t i, j, k, wordlen, depth;
+
+	if (allocate_payload(p, NUM_CODEPOINTS, 1)) {
+		return 1;
+	}
+	p->len[0] = NUM_CODEPOINTS;
+	p->mode[0] = GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL;
+
+	/* words of up to 8 codepoints separated by spaces */
+	for (i = 0, k = 0, depth = 0; i < NUM_CODEPOINTS; k++) {
+		state = state * 1103515245 + 12345;
+		wordlen = 1 + (state >> 16) % 8;
+
+		for (j = 0; j < wordlen && i < NUM_CODEPOINTS; j++) {
+			switch (type) {
+			case TEXT_LTR:
+				cp = pick(&state, latin, LEN(latin));
+				break;
+			case TEXT_RTL:
+				cp = pick(&state, hebrew, LEN(hebrew));
+				break;
+			case TEXT_MIXED:
+				/* alternate words, numbers have separators */
+				if (k % 3 == 0) {
+					cp = pick(&state, arabic, LEN(arabic));
+				} else if (k % 3 == 1) {
+					cp = pick(&state, latin, LEN(latin));
+				} else if (j % 2 == 0) {
+					cp = pick(&state, digit, LEN(digit));
+				} else {
+					cp = pick(&state, separator,
+					          LEN(separator));
+				}
+				break;
+			case TEXT_ISOLATES:
+				/* nest up to 32 isolates and close them */
+				state = state * 1103515245 + 12345;
+				if (depth < LEN(stack) &&
+				    (state >> 16) % 4 == 0) {
+					cp = pick(&state, isolate,
+					          LEN(isolate));
+					depth++;
+				} else if (depth > 0 &&
+				           (state >> 16) % 4 == 1) {
+					/* POP DIRECTIONAL ISOLATE */
+					cp = 0x2069;
+					depth--;
+				} else {
+					cp = (depth % 2) ?
+					             pick(&state, hebrew,
+					                  LEN(hebrew)) :
+					             pick(&state, latin,
+					                  LEN(latin));
+				}
+				break;
+			case TEXT_NESTED_ISOLATES:
+				/*
+				 * nest up to 300 isolates alternating in
+				 * direction, beyond the maximum depth, and
+				 * close them all in the second half
+				 */
+				state = state * 1103515245 + 12345;
+				if (i < NUM_CODEPOINTS / 2 && depth < 300 &&
+				    (state >> 16) % 8 == 0) {
+					/* RIGHT-TO-LEFT/LEFT-TO-RIGHT ISOLATE */
+					cp = (depth % 2) ? 0x2066 : 0x2067;
+					depth++;
+				} else if (i >= NUM_CODEPOINTS / 2 && depth > 0 &&
+				           (state >> 16) % 8 == 0) {
+					/* POP DIRECTIONAL ISOLATE */
+					cp = 0x2069;
+					depth--;
+				} else {
+					cp = (depth % 2) ?
+					             pick(&state, hebrew,
+					                  LEN(hebrew)) :
+					             pick(&state, latin,
+					                  LEN(latin));
+				}
+				break;
+			case TEXT_EMBEDDINGS:
+				/*
+				 * nest up to 120 embeddings alternating in
+				 * direction, each raising the level by one
+				 */
+				state = state * 1103515245 + 12345;
+				if (depth < 120 && (state >> 16) % 4 < 2) {
+					/* RTL/LTR EMBEDDING */
+					cp = (depth % 2) ? 0x202A : 0x202B;
+					depth++;
+				} else if (depth > 0 &&
+				           (state >> 16) % 4 == 2) {
+					/* POP DIRECTIONAL FORMATTING */
+					cp = 0x202C;
+					depth--;
+				} else {
+					cp = (depth % 2) ?
+					             pick(&state, hebrew,
+					                  LEN(hebrew)) :
+					             pick(&state, latin,
+					                  LEN(latin));
+				}
+				break;
+			case TEXT_UNCLOSED_BRACKETS:
+				/*
+				 * bracket every other word, which is
+				 * right-to-left, behind an opening bracket
+				 * that is never closed
+				 */
+				if (i == 0) {
+					cp = '(';
+				} else if (k % 2 == 0) {
+					cp = pick(&state, latin, LEN(latin));
+				} else if (j == 0) {
+					cp = '[';
+				} else if (j + 1 == wordlen) {
+					cp = ']';
+				} else {
+					cp = pick(&state, hebrew, LEN(hebrew));
+				}
+				break;
+			case TEXT_BRACKETS:
+			default:
+				/* open brackets are closed in stack order */
+				state = state * 1103515245 + 12345;
+				if (depth < LEN(stack) &&
+				    (state >> 16) % 3 == 0) {
+					cp = pick(&state, open_bracket,
+					          LEN(open_bracket));
+					stack[depth++] = cp;
+				} else if (depth > 0 &&
+				           (state >> 16) % 3 == 1) {
+					cp = stack[--depth];
+					cp = (cp == '(') ? ')' :
+					     (cp == '[') ? ']' :
+					     (cp == '{') ? '}' :
+					                   cp + 1;
+				} else {
+					cp = (j % 2) ?
+					             pick(&state, hebrew,
+					                  LEN(hebrew)) :
+					             pick(&state, latin,
+					                  LEN(latin));
+				}
+				break;
+			}
+			p->src[i++] = cp;
+		}
+		if (i < NUM_CODEPOINTS) {
+			p->src[i++] = ' ';
+		}
+	}
+
+	return 0;
+}
+
+static void
+run_phases(const struct bidirectional_benchmark_payload *p, const char *name,
+           double *baseline, size_t num_iterations)
+{
+	char buf[7][128];
+	size_t i, maxlen;
+
+	snprintf(buf[0], sizeof(buf[0]), "libgrapheme (%s, is trivial)",
+	         name);
+	snprintf(buf[1], sizeof(buf[1]), "libgrapheme (%s, preprocess)",
+	         name);
+	snprintf(buf[2], sizeof(buf[2]), "libgrapheme (%s, line levels)",
+	         name);
+	snprintf(buf[3], sizeof(buf[3]), "libgrapheme (%s, reorder)", name);
+	snprintf(buf[4], sizeof(buf[4]), "libgrapheme (%s, reorder map)",
+	         name);
+	snprintf(buf[5], sizeof(buf[5]), "libgrapheme (%s, layout)", name);
+	snprintf(buf[6], sizeof(buf[6]),
+	         "libgrapheme (%s, preprocess compact)", name);
+
+	/*
+	 * the later phases depend on the preprocessed data, which is
+	 * left behind by the first phase
+	 */
+	run_benchmark(libgrapheme_is_trivial, p, buf[0], "pure LTR",
+	              "codepoint", &baseline[0], num_iterations, p->srclen);
+	run_benchmark(libgrapheme_preprocess, p, buf[1], "pure LTR",
+	              "codepoint", &baseline[1], num_iterations, p->srclen);
+	run_benchmark(libgrapheme_line_levels, p, buf[2], "pure LTR",
+	              "codepoint", &baseline[2], num_iterations, p->srclen);
+	run_benchmark(libgrapheme_reorder, p, buf[3], "pure LTR",
+	              "codepoint", &baseline[3], num_iterations, p->srclen);
+	run_benchmark(libgrapheme_reorder_map, p, buf[4], "pure LTR",
+	              "codepoint", &baseline[4], num_iterations, p->srclen);
+	run_benchmark(libgrapheme_layout, p, buf[5], "pure LTR", "codepoint",
+	              &baseline[5], num_iterations, p->srclen);
+	run_benchmark(libgrapheme_preprocess_compact, p, buf[6], "pure LTR",
+	              "codepoint", &baseline[6], num_iterations, p->srclen);
+
+	/*
+	 * the memory taken by the compact states of the paragraphs as
+	 * one document once they are resolved, and while resolving
+	 * them, where the buffer for the longest paragraph is needed in
+	 * addition
+	 */
+	for (i = 0, maxlen = 0; i < p->count; i++) {
+		maxlen = (p->len[i] > maxlen) ? p->len[i] : maxlen;
+	}
+	printf("\tlibgrapheme (%s, compact states) %.2f bytes/codepoint "
+	       "stored, %.2f while resolving\n",
+	       name, (double)sizeof(*(p->compact)),
+	       (double)(p->srclen * sizeof(*(p->compact)) +
+	                maxlen * sizeof(*(p->data))) /
+	               (double)p->srclen);
+}
 
 int
 main(int argc, char *argv[])
 {
+	struct bidirectional_benchmark_payload p;
+	double baseline[7] = { (double)NAN, (double)NAN, (double)NAN,
+	                       (double)NAN, (double)NAN, (double)NAN,
+	                       (double)NAN };
+	size_t i;
+
 	(void)argc;
-	(void)argv;
+
+	printf("%s\n", argv[0]);
+
+	/* synthetic paragraphs, compared against pure LTR text */
+	for (i = 0; i < NUM_TEXT_TYPES; i++) {
+		if (generate_paragraph(&p, (enum text_type)i)) {
+			return 1;
+		}
+		run_phases(&p, text_type_name[i], baseline, NUM_ITERATIONS);
+		free_payload(&p);
+	}
+
+	/* the conformance tests, which are many short paragraphs */
+	if (generate_test_paragraphs(&p)) {
+		return 1;
+	}
+	run_phases(&p, "conformance tests", baseline, NUM_TEST_ITERATIONS);
+	free_payload(&p);
 
 	return 0;
 }
@@ -10,7 +10,10 @@
 #include "../grapheme.h"
 #include "util.h"
 
-#define NUM_ITERATIONS 10000
+#define NUM_ITERATIONS       10000
+#define NUM_ASCII_ITERATIONS 1000
+#define NUM_ASCII_WORDS      10000
+#define NUM_SIGMA_CODEPOINTS 100000
 
 struct break_benchmark_payload {
 	uint_least32_t *src;
@@ -19,6 +22,26 @@ struct break_benchmark_payload {
 	size_t destlen;
 };
 
+struct ascii_benchmark_payload {
+	uint_least32_t *cp;
+	char *utf8;
+	char *utf8upper;
+	uint_least32_t *cpupper;
+	size_t len;
+	uint_least32_t *cpdest;
+	char *utf8dest;
+	char *utf8upperdest;
+};
+
+struct batch_benchmark_payload {
+	const char **src;
+	size_t *srclen;
+	size_t count;
+	char *dest;
+	size_t destlen;
+	size_t *ends;
+};
+
 void
 libgrapheme(const void *payload)
 {
@@ -27,10 +50,309 @@ libgrapheme(const void *payload)
 	grapheme_to_uppercase(p->src, p->srclen, p->dest, p->destlen);
 }
 
+static void
+libgrapheme_measure(const void *payload)
+{
+	const struct break_benchmark_payload *p = payload;
+
+	/* determine the output length first, as callers sizing their buffer */
+	if (grapheme_to_uppercase(p->src, p->srclen, NULL, 0) > p->destlen) {
+		fprintf(stderr, "libgrapheme_measure: Buffer too small.\n");
+		exit(1);
+	}
+	grapheme_to_uppercase(p->src, p->srclen, p->dest, p->destlen);
+}
+
+static void
+libgrapheme_lowercase(const void *payload)
+{
+	const struct break_benchmark_payload *p = payload;
+
+	grapheme_to_lowercase(p->src, p->srclen, p->dest, p->destlen);
+}
+
+static void
+libgrapheme_titlecase(const void *payload)
+{
+	const struct break_benchmark_payload *p = payload;
+
+	grapheme_to_titlecase(p->src, p->srclen, p->dest, p->destlen);
+}
+
+static void
+libgrapheme_ascii_titlecase_utf8(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	grapheme_to_titlecase_utf8(p->utf8, p->len, p->utf8dest, p->len + 1);
+}
+
+static void
+libgrapheme_ascii_cp(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	grapheme_to_lowercase(p->cp, p->len, p->cpdest, p->len + 1);
+}
+
+static void
+libgrapheme_ascii_measure_utf8(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	if (grapheme_to_uppercase_utf8(p->utf8, p->len, NULL, 0) > p->len) {
+		fprintf(stderr,
+		        "libgrapheme_ascii_measure_utf8: Buffer too small.\n");
+		exit(1);
+	}
+	grapheme_to_uppercase_utf8(p->utf8, p->len, p->utf8upperdest,
+	                           p->len + 1);
+}
+
+static void
+libgrapheme_ascii_upper_utf8(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	grapheme_to_uppercase_utf8(p->utf8, p->len, p->utf8upperdest,
+	                           p->len + 1);
+}
+
+static void
+libgrapheme_ascii_utf8(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	grapheme_to_lowercase_utf8(p->utf8, p->len, p->utf8dest, p->len + 1);
+}
+
+static void
+libgrapheme_lowercase_memcmp(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	grapheme_to_lowercase_utf8(p->utf8, p->len, p->utf8dest, p->len + 1);
+	grapheme_to_lowercase_utf8(p->utf8upper, p->len, p->utf8upperdest,
+	                           p->len + 1);
+	if (memcmp(p->utf8dest, p->utf8upperdest, p->len)) {
+		fprintf(stderr, "libgrapheme_lowercase_memcmp: Mismatch.\n");
+		exit(1);
+	}
+}
+
+static void
+libgrapheme_caseless_compare(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	if (grapheme_caseless_compare_utf8(p->utf8, p->len, p->utf8upper,
+	                                   p->len)) {
+		fprintf(stderr, "libgrapheme_caseless_compare: Mismatch.\n");
+		exit(1);
+	}
+}
+
+static void
+libgrapheme_lowercase_hash(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+	uint_least64_t hash = UINT64_C(0xCBF29CE484222325);
+	size_t i;
+
+	/* FNV-1a over the lowercased string */
+	grapheme_to_lowercase_utf8(p->utf8upper, p->len, p->utf8dest,
+	                           p->len + 1);
+	for (i = 0; i < p->len; i++) {
+		hash = (hash ^ (unsigned char)p->utf8dest[i]) *
+		       UINT64_C(0x100000001B3);
+	}
+	if (hash == 0) {
+		fprintf(stderr, "libgrapheme_lowercase_hash: Zero hash.\n");
+		exit(1);
+	}
+}
+
+static void
+libgrapheme_caseless_hash(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	if (grapheme_caseless_hash_utf8(p->utf8upper, p->len, 0) == 0) {
+		fprintf(stderr, "libgrapheme_caseless_hash: Zero hash.\n");
+		exit(1);
+	}
+}
+
+static void
+libgrapheme_ascii_is_upper_cp(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	if (!grapheme_is_uppercase(p->cpupper, p->len, NULL)) {
+		fprintf(stderr,
+		        "libgrapheme_ascii_is_upper_cp: Not uppercase.\n");
+		exit(1);
+	}
+}
+
+static void
+libgrapheme_ascii_is_upper_utf8(const void *payload)
+{
+	const struct ascii_benchmark_payload *p = payload;
+
+	if (!grapheme_is_uppercase_utf8(p->utf8upper, p->len, NULL)) {
+		fprintf(stderr,
+		        "libgrapheme_ascii_is_upper_utf8: Not uppercase.\n");
+		exit(1);
+	}
+}
+
+static void
+libgrapheme_batch_loop(const void *payload)
+{
+	const struct batch_benchmark_payload *p = payload;
+	size_t i, off;
+
+	/* measure the arena and then convert each string into it */
+	for (i = 0, off = 0; i < p->count; i++) {
+		off += grapheme_to_lowercase_utf8(p->src[i], p->srclen[i],
+		                                  NULL, 0);
+	}
+	if (off >= p->destlen) {
+		fprintf(stderr, "libgrapheme_batch_loop: Arena too small.\n");
+		exit(1);
+	}
+	for (i = 0, off = 0; i < p->count; i++) {
+		off += grapheme_to_lowercase_utf8(p->src[i], p->srclen[i],
+		                                  p->dest + off,
+		                                  p->destlen - off);
+		p->ends[i] = off;
+	}
+}
+
+static void
+libgrapheme_batch(const void *payload)
+{
+	const struct batch_benchmark_payload *p = payload;
+
+	if (grapheme_to_lowercase_batch_utf8(p->src, p->srclen, p->count, NULL,
+	                                     0, NULL) >= p->destlen) {
+		fprintf(stderr, "libgrapheme_batch: Arena too small.\n");
+		exit(1);
+	}
+	grapheme_to_lowercase_batch_utf8(p->src, p->srclen, p->count, p->dest,
+	                                 p->destlen, p->ends);
+}
+
+static int
+generate_ascii_text(struct ascii_benchmark_payload *p)
+{
+	static const char *alphabet = "abcdefghijklmnopqrstuvwxyz"
+	                              "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+	                              "0123456789_.@";
+	uint_least32_t state = 1;
+	size_t i, j, wordlen;
+
+	/* identifiers and email addresses of up to 24 characters */
+	p->len = NUM_ASCII_WORDS * 25;
+	if ((p->cp = calloc(p->len, sizeof(*(p->cp)))) == NULL ||
+	    (p->utf8 = calloc(p->len, sizeof(*(p->utf8)))) == NULL ||
+	    (p->cpdest = calloc(p->len + 1, sizeof(*(p->cpdest)))) == NULL ||
+	    (p->utf8upper = calloc(p->len + 1, sizeof(*(p->utf8upper)))) ==
+	            NULL ||
+	    (p->cpupper = calloc(p->len, sizeof(*(p->cpupper)))) == NULL ||
+	    (p->utf8dest = calloc(p->len + 1, sizeof(*(p->utf8dest)))) ==
+	            NULL ||
+	    (p->utf8upperdest =
+	             calloc(p->len + 1, sizeof(*(p->utf8upperdest)))) == NULL) {
+		fprintf(stderr, "calloc: Out of memory\n");
+		return 1;
+	}
+	for (i = 0, p->len = 0; i < NUM_ASCII_WORDS; i++) {
+		state = state * 1103515245 + 12345;
+		wordlen = 1 + (state >> 16) % 24;
+		for (j = 0; j < wordlen; j++) {
+			state = state * 1103515245 + 12345;
+			p->utf8[p->len++] = alphabet[(state >> 16) % 65];
+		}
+		p->utf8[p->len++] = ' ';
+	}
+	for (i = 0; i < p->len; i++) {
+		p->cp[i] = (uint_least32_t)p->utf8[i];
+	}
+	grapheme_to_uppercase_utf8(p->utf8, p->len, p->utf8upper, p->len + 1);
+	for (i = 0; i < p->len; i++) {
+		p->cpupper[i] = (uint_least32_t)p->utf8upper[i];
+	}
+
+	return 0;
+}
+
+static int
+generate_batch(const struct ascii_benchmark_payload *ap,
+               struct batch_benchmark_payload *p)
+{
+	size_t i, start;
+
+	/* the space-separated words of the uppercased ASCII text */
+	p->count = NUM_ASCII_WORDS;
+	p->destlen = ap->len + 1;
+	if ((p->src = calloc(p->count, sizeof(*(p->src)))) == NULL ||
+	    (p->srclen = calloc(p->count, sizeof(*(p->srclen)))) == NULL ||
+	    (p->dest = calloc(p->destlen, sizeof(*(p->dest)))) == NULL ||
+	    (p->ends = calloc(p->count, sizeof(*(p->ends)))) == NULL) {
+		fprintf(stderr, "calloc: Out of memory\n");
+		return 1;
+	}
+	for (i = 0, p->count = 0, start = 0; i < ap->len; i++) {
+		if (ap->utf8upper[i] == ' ') {
+			p->src[p->count] = ap->utf8upper + start;
+			p->srclen[p->count] = i - start;
+			p->count++;
+			start = i + 1;
+		}
+	}
+
+	return 0;
+}
+
+static int
+generate_sigma_text(struct break_benchmark_payload *p, size_t runlen)
+{
+	size_t i;
+
+	/*
+	 * capital sigmas after a cased letter, each followed by a run of
+	 * case-ignorable combining acute accents, such that the
+	 * Final_Sigma-rule has to look past every run
+	 */
+	p->srclen = NUM_SIGMA_CODEPOINTS;
+	if ((p->src = calloc(p->srclen, sizeof(*(p->src)))) == NULL ||
+	    (p->dest = calloc((p->destlen = p->srclen + 1),
+	                      sizeof(*(p->dest)))) == NULL) {
+		fprintf(stderr, "calloc: Out of memory\n");
+		return 1;
+	}
+	p->src[0] = UINT32_C(0x0391); /* GREEK CAPITAL LETTER ALPHA */
+	for (i = 1; i < p->srclen; i++) {
+		if ((i - 1) % (runlen + 1) == 0) {
+			/* GREEK CAPITAL LETTER SIGMA */
+			p->src[i] = UINT32_C(0x03A3);
+		} else {
+			/* COMBINING ACUTE ACCENT */
+			p->src[i] = UINT32_C(0x0301);
+		}
+	}
+
+	return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
 	struct break_benchmark_payload p;
+	struct ascii_benchmark_payload ap;
+	struct batch_benchmark_payload bp;
 	double baseline = (double)NAN;
 
 	(void)argc;
@@ -48,9 +370,115 @@ main(int argc, char *argv[])
 	printf("%s\n", argv[0]);
 	run_benchmark(libgrapheme, &p, "libgrapheme ", NULL, "codepoint",
 	              &baseline, NUM_ITERATIONS, p.srclen - 1);
+	run_benchmark(libgrapheme_measure, &p, "libgrapheme (measure first)",
+	              NULL, "codepoint", &baseline, NUM_ITERATIONS,
+	              p.srclen - 1);
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_titlecase, &p, "libgrapheme (titlecase)",
+	              NULL, "codepoint", &baseline, NUM_ITERATIONS,
+	              p.srclen - 1);
+
+	free(p.src);
+	free(p.dest);
 
+	/*
+	 * the Final_Sigma lookahead stays linear no matter how long the
+	 * case-ignorable runs after the sigmas are
+	 */
+	baseline = (double)NAN;
+	if (generate_sigma_text(&p, 1)) {
+		return 1;
+	}
+	run_benchmark(libgrapheme_lowercase, &p,
+	              "libgrapheme (Final_Sigma, short runs)", NULL,
+	              "codepoint", &baseline, NUM_ASCII_ITERATIONS, p.srclen);
 	free(p.src);
 	free(p.dest);
+	if (generate_sigma_text(&p, 1000)) {
+		return 1;
+	}
+	run_benchmark(libgrapheme_lowercase, &p,
+	              "libgrapheme (Final_Sigma, long runs)", "short runs",
+	              "codepoint", &baseline, NUM_ASCII_ITERATIONS, p.srclen);
+	free(p.src);
+	free(p.dest);
+
+	/*
+	 * mostly-ASCII text is converted in runs when it is given in
+	 * UTF-8, compared to the codepoint-wise conversion
+	 */
+	if (generate_ascii_text(&ap)) {
+		return 1;
+	}
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_ascii_cp, &ap,
+	              "libgrapheme (ASCII, codepoint)", NULL, "character",
+	              &baseline, NUM_ASCII_ITERATIONS, ap.len);
+	run_benchmark(libgrapheme_ascii_utf8, &ap, "libgrapheme (ASCII, UTF-8)",
+	              "ASCII runs", "character", &baseline,
+	              NUM_ASCII_ITERATIONS, ap.len);
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_ascii_upper_utf8, &ap,
+	              "libgrapheme (ASCII, UTF-8, uppercase)", NULL,
+	              "character", &baseline, NUM_ASCII_ITERATIONS, ap.len);
+	run_benchmark(libgrapheme_ascii_measure_utf8, &ap,
+	              "libgrapheme (ASCII, UTF-8, measure first)", NULL,
+	              "character", &baseline, NUM_ASCII_ITERATIONS, ap.len);
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_ascii_titlecase_utf8, &ap,
+	              "libgrapheme (ASCII, UTF-8, titlecase)", NULL,
+	              "character", &baseline, NUM_ASCII_ITERATIONS, ap.len);
+
+	/* checking uppercased text, which has to be read entirely */
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_ascii_is_upper_cp, &ap,
+	              "libgrapheme (ASCII, codepoint, is uppercase)", NULL,
+	              "character", &baseline, NUM_ASCII_ITERATIONS, ap.len);
+	run_benchmark(libgrapheme_ascii_is_upper_utf8, &ap,
+	              "libgrapheme (ASCII, UTF-8, is uppercase)", "codepoint",
+	              "character", &baseline, NUM_ASCII_ITERATIONS, ap.len);
+
+	/* comparing case-insensitively against an uppercased copy */
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_lowercase_memcmp, &ap,
+	              "libgrapheme (lowercase and memcmp)", NULL, "character",
+	              &baseline, NUM_ASCII_ITERATIONS, ap.len);
+	run_benchmark(libgrapheme_caseless_compare, &ap,
+	              "libgrapheme (caseless compare)", "one pass", "character",
+	              &baseline, NUM_ASCII_ITERATIONS, ap.len);
+
+	/* lowercasing many short strings into one arena */
+	if (generate_batch(&ap, &bp)) {
+		return 1;
+	}
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_batch_loop, &bp,
+	              "libgrapheme (short strings, one by one)", NULL, "string",
+	              &baseline, NUM_ASCII_ITERATIONS, bp.count);
+	run_benchmark(libgrapheme_batch, &bp, "libgrapheme (short strings, batch)",
+	              "one by one", "string", &baseline, NUM_ASCII_ITERATIONS,
+	              bp.count);
+	free(bp.src);
+	free(bp.srclen);
+	free(bp.dest);
+	free(bp.ends);
+
+	/* hashing case-insensitively */
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_lowercase_hash, &ap,
+	              "libgrapheme (lowercase and FNV-1a)", NULL, "character",
+	              &baseline, NUM_ASCII_ITERATIONS, ap.len);
+	run_benchmark(libgrapheme_caseless_hash, &ap,
+	              "libgrapheme (caseless hash)", "one pass", "character",
+	              &baseline, NUM_ASCII_ITERATIONS, ap.len);
+
+	free(ap.cp);
+	free(ap.utf8);
+	free(ap.utf8upper);
+	free(ap.cpupper);
+	free(ap.cpdest);
+	free(ap.utf8dest);
+	free(ap.utf8upperdest);
 
 	return 0;
 }
@@ -10,13 +10,32 @@
 #include "../grapheme.h"
 #include "util.h"
 
-#define NUM_ITERATIONS 10000
+#define NUM_ITERATIONS           10000
+#define NUM_COLUMNS              80
+#define NUM_PARAGRAPH_ITERATIONS 100
+#define NUM_PARAGRAPH_WORDS      50000
 
 struct break_benchmark_payload {
 	uint_least32_t *buf;
 	size_t buflen;
 };
 
+struct paragraph_benchmark_payload {
+	uint_least32_t *buf;
+	size_t buflen;
+	size_t *work;
+	size_t worklen;
+};
+
+struct update_benchmark_payload {
+	uint_least32_t *buf;
+	size_t buflen;
+	size_t off;
+	size_t *lines;
+	size_t lineslen;
+	size_t *nlines;
+};
+
 void
 libgrapheme(const void *payload)
 {
@@ -28,10 +47,94 @@ libgrapheme(const void *payload)
 	}
 }
 
+static void
+libgrapheme_wrap(const void *payload)
+{
+	const struct break_benchmark_payload *p = payload;
+	size_t off;
+
+	for (off = 0; off < p->buflen;) {
+		off += grapheme_wrap_line(p->buf + off, p->buflen - off,
+		                          NUM_COLUMNS, NULL);
+	}
+}
+
+static void
+libgrapheme_paragraph_greedy(const void *payload)
+{
+	const struct paragraph_benchmark_payload *p = payload;
+	size_t off;
+
+	for (off = 0; off < p->buflen;) {
+		off += grapheme_wrap_line(p->buf + off, p->buflen - off,
+		                          NUM_COLUMNS, NULL);
+	}
+}
+
+static void
+libgrapheme_paragraph_optimal(const void *payload)
+{
+	const struct paragraph_benchmark_payload *p = payload;
+
+	grapheme_wrap_paragraph(p->buf, p->buflen, NUM_COLUMNS, p->work,
+	                        p->worklen);
+}
+
+static void
+libgrapheme_update_full(const void *payload)
+{
+	const struct update_benchmark_payload *p = payload;
+
+	/* type a character and wrap everything again */
+	p->buf[p->off] = (p->buf[p->off] == 'x') ? 'y' : 'x';
+	*(p->nlines) = grapheme_wrap_update(p->buf, p->buflen, NUM_COLUMNS, 0,
+	                                    0, p->buflen, p->lines,
+	                                    p->lineslen, 0);
+}
+
+static void
+libgrapheme_update_incremental(const void *payload)
+{
+	const struct update_benchmark_payload *p = payload;
+
+	/* type a character and only wrap the affected lines again */
+	p->buf[p->off] = (p->buf[p->off] == 'x') ? 'y' : 'x';
+	*(p->nlines) = grapheme_wrap_update(p->buf, p->buflen, NUM_COLUMNS,
+	                                    p->off, 1, 1, p->lines,
+	                                    p->lineslen, *(p->nlines));
+}
+
+static uint_least32_t *
+generate_paragraph(size_t *buflen)
+{
+	uint_least32_t *buf;
+	size_t i, j, off, wordlen;
+
+	/* words of varying length separated by spaces */
+	*buflen = NUM_PARAGRAPH_WORDS * 12;
+	if (!(buf = calloc(*buflen, sizeof(*buf)))) {
+		fprintf(stderr, "calloc: %s\n", strerror(errno));
+		exit(1);
+	}
+	for (i = 0, off = 0; i < NUM_PARAGRAPH_WORDS; i++) {
+		wordlen = 1 + (i * 7) % 11;
+		for (j = 0; j < wordlen; j++) {
+			buf[off++] = 'a' + (i + j) % 26;
+		}
+		buf[off++] = ' ';
+	}
+	*buflen = off;
+
+	return buf;
+}
+
 int
 main(int argc, char *argv[])
 {
 	struct break_benchmark_payload p;
+	struct paragraph_benchmark_payload q;
+	struct update_benchmark_payload u;
+	size_t nlines;
 	double baseline = (double)NAN;
 
 	(void)argc;
@@ -45,8 +148,57 @@ main(int argc, char *argv[])
 	printf("%s\n", argv[0]);
 	run_benchmark(libgrapheme, &p, "libgrapheme ", NULL, "codepoint",
 	              &baseline, NUM_ITERATIONS, p.buflen - 1);
+	run_benchmark(libgrapheme_wrap, &p, "libgrapheme (wrap)",
+	              "wrapping to 80 columns", "codepoint", &baseline,
+	              NUM_ITERATIONS, p.buflen - 1);
 
 	free(p.buf);
 
+	/* a paragraph with NUM_PARAGRAPH_WORDS break opportunities */
+	q.buf = generate_paragraph(&(q.buflen));
+	q.worklen = 7 * (q.buflen + 1);
+	if (!(q.work = calloc(q.worklen, sizeof(*(q.work))))) {
+		fprintf(stderr, "calloc: %s\n", strerror(errno));
+		exit(1);
+	}
+
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_paragraph_greedy, &q,
+	              "libgrapheme (paragraph, greedy)", NULL, "codepoint",
+	              &baseline, NUM_PARAGRAPH_ITERATIONS, q.buflen);
+	run_benchmark(libgrapheme_paragraph_optimal, &q,
+	              "libgrapheme (paragraph, optimal)",
+	              "minimum raggedness", "codepoint", &baseline,
+	              NUM_PARAGRAPH_ITERATIONS, q.buflen);
+
+	free(q.work);
+
+	/* typing in the middle of the paragraph */
+	u.buf = q.buf;
+	u.buflen = q.buflen;
+	for (u.off = u.buflen / 2; u.buf[u.off] == ' '; u.off++) {
+		;
+	}
+	u.lineslen = 2 * (u.buflen + 1);
+	if (!(u.lines = calloc(u.lineslen, sizeof(*(u.lines))))) {
+		fprintf(stderr, "calloc: %s\n", strerror(errno));
+		exit(1);
+	}
+	u.nlines = &nlines;
+	nlines = grapheme_wrap_update(u.buf, u.buflen, NUM_COLUMNS, 0, 0,
+	                              u.buflen, u.lines, u.lineslen, 0);
+
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_update_full, &u,
+	              "libgrapheme (update, full)", NULL, "codepoint",
+	              &baseline, NUM_PARAGRAPH_ITERATIONS, u.buflen);
+	run_benchmark(libgrapheme_update_incremental, &u,
+	              "libgrapheme (update, incremental)",
+	              "rewrapping affected lines", "codepoint", &baseline,
+	              NUM_PARAGRAPH_ITERATIONS, u.buflen);
+
+	free(q.buf);
+	free(u.lines);
+
 	return 0;
 }
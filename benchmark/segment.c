@@ -0,0 +1,141 @@
+/* See LICENSE file for copyright and license details. */
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../gen/word-test.h"
+#include "../grapheme.h"
+#include "util.h"
+
+#define NUM_ITERATIONS       1000
+#define NUM_MIXED_ITERATIONS 100
+#define NUM_MIXED_WORDS      100000
+
+struct segment_benchmark_payload {
+	char *buf;
+	size_t buflen;
+};
+
+static void
+libgrapheme_separate(const void *payload)
+{
+	const struct segment_benchmark_payload *p = payload;
+	size_t off, count[4] = { 0 };
+
+	for (off = 0; off < p->buflen; count[0]++) {
+		off += grapheme_next_character_break_utf8(p->buf + off,
+		                                          p->buflen - off);
+	}
+	for (off = 0; off < p->buflen; count[1]++) {
+		off += grapheme_next_word_break_utf8(p->buf + off,
+		                                     p->buflen - off);
+	}
+	for (off = 0; off < p->buflen; count[2]++) {
+		off += grapheme_next_sentence_break_utf8(p->buf + off,
+		                                         p->buflen - off);
+	}
+	for (off = 0; off < p->buflen; count[3]++) {
+		off += grapheme_next_line_break_utf8(p->buf + off,
+		                                     p->buflen - off);
+	}
+	(void)count;
+}
+
+static void
+libgrapheme_fused(const void *payload)
+{
+	const struct segment_benchmark_payload *p = payload;
+	struct grapheme_segmentation seg[4] = { { 0 } };
+
+	grapheme_segment_utf8(p->buf, p->buflen,
+	                      GRAPHEME_SEGMENTATION_CHARACTER |
+	                              GRAPHEME_SEGMENTATION_WORD |
+	                              GRAPHEME_SEGMENTATION_SENTENCE |
+	                              GRAPHEME_SEGMENTATION_LINE,
+	                      seg);
+}
+
+static char *
+generate_mixed_text(size_t *buflen)
+{
+	/* first and last codepoint of the letters of some scripts */
+	static const uint_least32_t script[][2] = {
+		{ 0x0061, 0x007A }, /* Latin */
+		{ 0x03B1, 0x03C9 }, /* Greek */
+		{ 0x0430, 0x044F }, /* Cyrillic */
+		{ 0x0627, 0x064A }, /* Arabic */
+		{ 0x0915, 0x0939 }, /* Devanagari */
+		{ 0x0E01, 0x0E2E }, /* Thai */
+		{ 0x4E00, 0x9FFF }, /* CJK */
+		{ 0xAC00, 0xD7A3 }, /* Hangul */
+		{ 0x1F600, 0x1F64F }, /* Emoji */
+	};
+	uint_least32_t rnd = 1, cp;
+	size_t i, j, s, off, wordlen;
+	char *buf;
+
+	/* words of varying length in varying scripts */
+	*buflen = NUM_MIXED_WORDS * 10 * 4;
+	if (!(buf = malloc(*buflen))) {
+		fprintf(stderr, "malloc: %s\n", strerror(errno));
+		exit(1);
+	}
+	for (i = 0, off = 0; i < NUM_MIXED_WORDS; i++) {
+		rnd = rnd * UINT32_C(1103515245) + 12345;
+		s = (rnd >> 16) % LEN(script);
+		wordlen = 2 + (rnd >> 8) % 7;
+		for (j = 0; j < wordlen; j++) {
+			rnd = rnd * UINT32_C(1103515245) + 12345;
+			cp = script[s][0] +
+			     (rnd >> 12) % (script[s][1] - script[s][0] + 1);
+			off += grapheme_encode_utf8(cp, buf + off,
+			                            *buflen - off);
+		}
+		buf[off++] = (i % 80 == 79) ? '\n' : (i % 12 == 11) ? '.' : ' ';
+	}
+	*buflen = off;
+
+	return buf;
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct segment_benchmark_payload p;
+	double baseline = (double)NAN;
+
+	(void)argc;
+
+	if ((p.buf = generate_utf8_test_buffer(word_break_test,
+	                                       LEN(word_break_test),
+	                                       &(p.buflen))) == NULL) {
+		return 1;
+	}
+	p.buflen--;
+
+	printf("%s\n", argv[0]);
+	run_benchmark(libgrapheme_separate, &p, "libgrapheme (separate)",
+	              "four passes", "byte", &baseline, NUM_ITERATIONS,
+	              p.buflen);
+	run_benchmark(libgrapheme_fused, &p, "libgrapheme (fused)",
+	              "one pass", "byte", &baseline, NUM_ITERATIONS, p.buflen);
+
+	free(p.buf);
+
+	p.buf = generate_mixed_text(&(p.buflen));
+
+	baseline = (double)NAN;
+	run_benchmark(libgrapheme_separate, &p,
+	              "libgrapheme (separate, mixed scripts)", "four passes",
+	              "byte", &baseline, NUM_MIXED_ITERATIONS, p.buflen);
+	run_benchmark(libgrapheme_fused, &p,
+	              "libgrapheme (fused, mixed scripts)", "one pass", "byte",
+	              &baseline, NUM_MIXED_ITERATIONS, p.buflen);
+
+	free(p.buf);
+
+	return 0;
+}
@@ -157,18 +157,40 @@ specialcasing_callback(const char *file, char **field, size_t nfields,
 	return 0;
 }
 
+static struct properties_compressed comp_upper, comp_lower, comp_title;
+
+/*
+ * The three case mappings of a codepoint are looked up through a
+ * shared major-minor-table, whose entries combine the indices into
+ * the compressed upper-, lower- and titlecase data, each below 2^16.
+ */
+static int_least64_t
+get_upper_offset(const struct properties *prop, size_t offset)
+{
+	return comp_upper.data[prop[offset].property & 0xFFFF].property;
+}
+
+static int_least64_t
+get_lower_offset(const struct properties *prop, size_t offset)
+{
+	return comp_lower.data[(prop[offset].property >> 16) & 0xFFFF]
+	        .property;
+}
+
 static int_least64_t
-get_value(const struct properties *prop, size_t offset)
+get_title_offset(const struct properties *prop, size_t offset)
 {
-	return prop[offset].property;
+	return comp_title.data[(prop[offset].property >> 32) & 0xFFFF]
+	        .property;
 }
 
 int
 main(int argc, char *argv[])
 {
-	struct properties_compressed comp_upper, comp_lower, comp_title;
-	struct properties_major_minor mm_upper, mm_lower, mm_title;
-	size_t i, j;
+	struct properties_compressed comp;
+	struct properties_major_minor mm;
+	struct properties *prop;
+	size_t i, j, *identity;
 
 	(void)argc;
 
@@ -201,12 +223,35 @@ main(int argc, char *argv[])
 	properties_compress(prop_lower, &comp_lower);
 	properties_compress(prop_title, &comp_title);
 
-	fprintf(stderr,
-	        "%s: LUT compression-ratios: upper=%.2f%%, lower=%.2f%%, "
-	        "title=%.2f%%\n",
-	        argv[0], properties_get_major_minor(&comp_upper, &mm_upper),
-	        properties_get_major_minor(&comp_lower, &mm_lower),
-	        properties_get_major_minor(&comp_title, &mm_title));
+	if (comp_upper.datalen > 0x10000 || comp_lower.datalen > 0x10000 ||
+	    comp_title.datalen > 0x10000) {
+		fprintf(stderr, "%s: Too many distinct case mappings.\n",
+		        argv[0]);
+		exit(1);
+	}
+
+	/* combine the mappings of each codepoint and compress them */
+	if (!(prop = calloc(UINT32_C(0x110000), sizeof(*prop)))) {
+		fprintf(stderr, "calloc: %s\n", strerror(errno));
+		exit(1);
+	}
+	for (i = 0; i < UINT32_C(0x110000); i++) {
+		prop[i].property = (int_least64_t)comp_upper.offset[i] |
+		                   (int_least64_t)comp_lower.offset[i] << 16 |
+		                   (int_least64_t)comp_title.offset[i] << 32;
+	}
+	properties_compress(prop, &comp);
+
+	fprintf(stderr, "%s: case-mapping-LUT compression-ratio: %.2f%%\n",
+	        argv[0], properties_get_major_minor(&comp, &mm));
+
+	if (!(identity = calloc(comp.datalen, sizeof(*identity)))) {
+		fprintf(stderr, "calloc: %s\n", strerror(errno));
+		exit(1);
+	}
+	for (i = 0; i < comp.datalen; i++) {
+		identity[i] = i;
+	}
 
 	/* print tables */
 	printf("/* Automatically generated by %s */\n#include "
@@ -216,23 +261,22 @@ main(int argc, char *argv[])
 	printf("struct special_case {\n\tuint_least32_t *cp;\n\tsize_t "
 	       "cplen;\n};\n\n");
 
-	properties_print_lookup_table("upper_major", mm_upper.major, 0x1100);
-	printf("\n");
-	properties_print_derived_lookup_table("upper_minor", mm_upper.minor,
-	                                      mm_upper.minorlen, get_value,
-	                                      comp_upper.data);
+	properties_print_lookup_table("case_mapping_major", mm.major, 0x1100);
 	printf("\n");
-	properties_print_lookup_table("lower_major", mm_lower.major, 0x1100);
+	properties_print_lookup_table("case_mapping_minor", mm.minor,
+	                              mm.minorlen);
 	printf("\n");
-	properties_print_derived_lookup_table("lower_minor", mm_lower.minor,
-	                                      mm_lower.minorlen, get_value,
-	                                      comp_lower.data);
+	properties_print_derived_lookup_table("upper_offset", identity,
+	                                      comp.datalen, get_upper_offset,
+	                                      comp.data);
 	printf("\n");
-	properties_print_lookup_table("title_major", mm_title.major, 0x1100);
+	properties_print_derived_lookup_table("lower_offset", identity,
+	                                      comp.datalen, get_lower_offset,
+	                                      comp.data);
 	printf("\n");
-	properties_print_derived_lookup_table("title_minor", mm_title.minor,
-	                                      mm_title.minorlen, get_value,
-	                                      comp_title.data);
+	properties_print_derived_lookup_table("title_offset", identity,
+	                                      comp.datalen, get_title_offset,
+	                                      comp.data);
 	printf("\n");
 
 	printf("static const struct special_case upper_special[] = {\n");
@@ -286,18 +330,18 @@ main(int argc, char *argv[])
 	}
 	printf("};\n\n");
 
+	free(comp.data);
+	free(comp.offset);
 	free(comp_lower.data);
 	free(comp_lower.offset);
 	free(comp_title.data);
 	free(comp_title.offset);
 	free(comp_upper.data);
 	free(comp_upper.offset);
-	free(mm_lower.major);
-	free(mm_lower.minor);
-	free(mm_title.major);
-	free(mm_title.minor);
-	free(mm_upper.major);
-	free(mm_upper.minor);
+	free(identity);
+	free(mm.major);
+	free(mm.minor);
+	free(prop);
 
 	return 0;
 }
@@ -0,0 +1,6578 @@
+/* Automatically generated by gen/case */
+#include <stdint.h>
+
+enum case_property {
+	CASE_PROP_OTHER,
+	CASE_PROP_BOTH_CASED_CASE_IGNORABLE,
+	CASE_PROP_CASED,
+	CASE_PROP_CASE_IGNORABLE,
+	CASE_PROP_UNCASED,
+	NUM_CASE_PROPS,
+};
+
+static const uint_least16_t case_major[] = {
+	0, 256, 512, 768, 1024, 1280, 1536, 1792,
+	2048, 2304, 2560, 2816, 3072, 3328, 3584, 3840,
+	4096, 4352, 4352, 4608, 4352, 4352, 4352, 4864,
+	5120, 5376, 5632, 5888, 6144, 6400, 6656, 6912,
+	7168, 7424, 4352, 4352, 7680, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 7936, 8192, 8448, 4352,
+	8704, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	8960, 4352, 4352, 4352, 9216, 4352, 9472, 9728,
+	9984, 10240, 10496, 10752, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 11008, 4352, 4352, 11264, 11520,
+	4352, 11776, 12032, 12288, 12544, 12800, 4352, 13056,
+	4352, 4352, 13312, 4352, 13568, 13824, 14080, 14336,
+	14592, 14848, 15104, 15360, 15616, 15872, 16128, 16384,
+	16640, 16896, 17152, 17408, 17664, 17920, 14008, 18176,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 18432, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 18688, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 18944, 19200, 4352, 19456, 19712, 19968,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 20224,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 20480, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 20736,
+	4352, 20992, 21248, 4352, 21504, 21760, 22016, 22272,
+	4352, 4352, 22528, 4352, 4352, 4352, 4352, 22784,
+	23040, 23296, 23552, 4352, 18949, 14013, 23808, 4352,
+	24064, 24320, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 24576, 4352, 9213, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	24832, 25088, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+	4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352
+};
+
+static const uint_least8_t case_minor[] = {
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 3, 0,
+	3, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 2, 0, 0, 3, 0, 3,
+	0, 0, 0, 0, 3, 2, 0, 3,
+	3, 0, 2, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 2, 2,
+	0, 0, 0, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 3, 3, 3, 3, 3, 3, 3,
+	1, 1, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	1, 1, 1, 1, 1, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 1, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	2, 2, 2, 2, 3, 3, 2, 2,
+	0, 0, 1, 2, 2, 2, 0, 2,
+	0, 0, 0, 0, 3, 3, 2, 3,
+	2, 2, 2, 0, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 3, 3, 3, 3, 3,
+	3, 3, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	0, 3, 0, 0, 0, 0, 0, 3,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	0, 3, 3, 0, 3, 3, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 3, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 3, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 3, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 3, 3, 0, 0, 0, 0, 3,
+	3, 0, 0, 3, 3, 3, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 0, 3,
+	3, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 3,
+	0, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 3, 3,
+	3, 0, 0, 0, 0, 0, 3, 3,
+	3, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 0, 0, 0,
+	0, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 3,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 3, 3, 3, 0, 3, 3,
+	0, 0, 0, 0, 0, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 3,
+	3, 0, 3, 3, 3, 3, 3, 3,
+	0, 3, 3, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 2,
+	0, 0, 0, 0, 0, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 1, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 0, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 0, 0, 0, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 0, 3, 0, 0, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 3, 3,
+	3, 3, 3, 0, 3, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 0, 0,
+	3, 3, 0, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	3, 3, 0, 0, 0, 3, 0, 3,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	1, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 2, 0, 2, 0, 2, 0, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 3, 2, 3,
+	3, 3, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 3, 3, 3,
+	2, 2, 2, 2, 0, 0, 2, 2,
+	2, 2, 2, 2, 0, 3, 3, 3,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 3, 3, 3,
+	0, 0, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 3,
+	0, 0, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 0, 0, 0, 0, 2,
+	0, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 2, 0, 0,
+	0, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 2, 0, 2, 0,
+	2, 0, 2, 2, 2, 2, 0, 2,
+	2, 2, 2, 2, 2, 0, 0, 0,
+	0, 2, 0, 0, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 2, 2, 2,
+	2, 2, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 2, 3,
+	3, 3, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 2,
+	0, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 0, 0,
+	0, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 3,
+	3, 3, 3, 0, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 1, 1, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	1, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 2, 2, 0,
+	1, 1, 2, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 3, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 3, 3,
+	3, 3, 0, 0, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 0,
+	0, 3, 3, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 3, 3, 0, 0, 3,
+	3, 0, 0, 0, 0, 0, 3, 3,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 0, 0,
+	0, 0, 0, 3, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 3, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 1, 3, 3, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	3, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 3, 0,
+	3, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 0, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 3, 3, 1, 1, 1, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 0, 3, 3, 0,
+	0, 0, 0, 0, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	0, 3, 3, 3, 3, 3, 0, 3,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 0,
+	0, 3, 3, 0, 0, 3, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 0, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 0, 0, 3, 0, 3, 3,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	3, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 3, 3, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 0, 3, 0, 0, 0, 0, 3,
+	3, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 3, 3, 0, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 3, 0, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 3, 0, 0,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 3,
+	0, 0, 3, 3, 3, 3, 0, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 0, 3, 0,
+	0, 0, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 0, 0, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 0,
+	0, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 3, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	3, 0, 3, 3, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 3, 0, 3, 3, 0, 3,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 3, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 0, 0, 0, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 0, 0, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 0, 3, 3, 3,
+	3, 3, 3, 3, 0, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	0, 0, 2, 0, 0, 2, 2, 0,
+	0, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 0, 2, 2, 2,
+	2, 2, 2, 2, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 2,
+	2, 2, 2, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 0, 2, 0,
+	0, 0, 2, 2, 2, 2, 2, 2,
+	2, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	0, 0, 0, 0, 0, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 0, 3, 3, 0, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 3, 3,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0
+};
+/* Automatically generated by gen/case */
+#include <stdint.h>
+#include <stddef.h>
+
+struct special_case {
+	uint_least32_t *cp;
+	size_t cplen;
+};
+
+static const uint_least16_t case_mapping_major[] = {
+	0, 256, 512, 768, 1024, 1280, 1536, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1792, 1416, 1416, 2048, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 2304, 2560, 2816, 3072,
+	1416, 3328, 1416, 1416, 3584, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 3840, 4096, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 4352, 4608,
+	1416, 1416, 1416, 4864, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 5120, 1416, 1416, 1416, 5376,
+	1416, 1416, 1416, 1416, 5632, 5888, 1416, 1416,
+	1416, 1416, 1416, 1416, 6144, 6400, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	6656, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 6912, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 7168, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416
+};
+
+static const uint_least16_t case_mapping_minor[] = {
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0,
+	1, 1, 1, 1, 1, 1, 1, 4,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 2, 2, 2, 5,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	8, 9, 6, 7, 6, 7, 6, 7,
+	0, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 6,
+	7, 10, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	11, 6, 7, 6, 7, 6, 7, 12,
+	13, 14, 6, 7, 6, 7, 15, 6,
+	7, 16, 16, 6, 7, 0, 17, 18,
+	19, 6, 7, 16, 20, 21, 22, 23,
+	6, 7, 24, 25, 22, 26, 27, 28,
+	6, 7, 6, 7, 6, 7, 29, 6,
+	7, 29, 0, 0, 6, 7, 29, 6,
+	7, 30, 30, 6, 7, 6, 7, 31,
+	6, 7, 0, 0, 6, 7, 0, 32,
+	0, 0, 0, 0, 33, 34, 35, 33,
+	34, 35, 33, 34, 35, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 36, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	37, 33, 34, 35, 6, 7, 38, 39,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	40, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 0,
+	0, 0, 41, 6, 7, 42, 43, 44,
+	44, 6, 7, 45, 46, 47, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	48, 49, 50, 51, 52, 0, 53, 53,
+	0, 54, 0, 55, 56, 0, 0, 0,
+	53, 57, 0, 58, 59, 60, 61, 0,
+	62, 63, 61, 64, 65, 0, 0, 63,
+	0, 66, 67, 0, 0, 68, 0, 0,
+	0, 0, 0, 0, 0, 69, 0, 0,
+	70, 0, 71, 70, 0, 0, 0, 72,
+	70, 73, 74, 74, 75, 0, 0, 0,
+	0, 0, 76, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 77, 78, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 79, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 6, 7, 0, 0, 6, 7,
+	0, 0, 0, 27, 27, 27, 0, 80,
+	0, 0, 0, 0, 0, 0, 81, 0,
+	82, 82, 82, 0, 83, 0, 84, 84,
+	85, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 86, 87, 87, 87,
+	88, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 89, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 90, 91, 91, 92,
+	93, 94, 0, 0, 0, 95, 96, 97,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	98, 99, 100, 101, 102, 103, 0, 6,
+	7, 104, 6, 7, 0, 40, 40, 40,
+	105, 105, 105, 105, 105, 105, 105, 105,
+	105, 105, 105, 105, 105, 105, 105, 105,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	99, 99, 99, 99, 99, 99, 99, 99,
+	99, 99, 99, 99, 99, 99, 99, 99,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 0, 0, 0, 0, 0, 0,
+	0, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	106, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 107,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	0, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 110,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 0, 111,
+	0, 0, 0, 0, 0, 111, 0, 0,
+	112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 0, 0, 112, 112, 112,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113,
+	92, 92, 92, 92, 92, 92, 0, 0,
+	97, 97, 97, 97, 97, 97, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	114, 115, 116, 117, 117, 118, 119, 120,
+	121, 6, 7, 0, 0, 0, 0, 0,
+	122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 0, 0, 122, 122, 122,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 123, 0, 0, 0, 124, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 125, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 126, 127,
+	128, 129, 130, 131, 0, 0, 132, 0,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	133, 133, 133, 133, 133, 133, 133, 133,
+	134, 134, 134, 134, 134, 134, 134, 134,
+	133, 133, 133, 133, 133, 133, 0, 0,
+	134, 134, 134, 134, 134, 134, 0, 0,
+	133, 133, 133, 133, 133, 133, 133, 133,
+	134, 134, 134, 134, 134, 134, 134, 134,
+	133, 133, 133, 133, 133, 133, 133, 133,
+	134, 134, 134, 134, 134, 134, 134, 134,
+	133, 133, 133, 133, 133, 133, 0, 0,
+	134, 134, 134, 134, 134, 134, 0, 0,
+	135, 133, 136, 133, 137, 133, 138, 133,
+	0, 134, 0, 134, 0, 134, 0, 134,
+	133, 133, 133, 133, 133, 133, 133, 133,
+	134, 134, 134, 134, 134, 134, 134, 134,
+	139, 139, 140, 140, 140, 140, 141, 141,
+	142, 142, 143, 143, 144, 144, 0, 0,
+	145, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192,
+	133, 133, 193, 194, 195, 0, 196, 197,
+	134, 134, 198, 198, 199, 0, 200, 0,
+	0, 0, 201, 202, 203, 0, 204, 205,
+	206, 206, 206, 206, 207, 0, 0, 0,
+	133, 133, 208, 209, 0, 0, 210, 211,
+	134, 134, 212, 212, 0, 0, 0, 0,
+	133, 133, 213, 214, 215, 100, 216, 217,
+	134, 134, 218, 218, 104, 0, 0, 0,
+	0, 0, 219, 220, 221, 0, 222, 223,
+	224, 224, 225, 225, 226, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 227, 0,
+	0, 0, 228, 229, 0, 0, 0, 0,
+	0, 0, 230, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 231, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	232, 232, 232, 232, 232, 232, 232, 232,
+	232, 232, 232, 232, 232, 232, 232, 232,
+	233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233,
+	0, 0, 0, 6, 7, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234,
+	235, 235, 235, 235, 235, 235, 235, 235,
+	235, 235, 235, 235, 235, 235, 235, 235,
+	235, 235, 235, 235, 235, 235, 235, 235,
+	235, 235, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109,
+	6, 7, 236, 237, 238, 239, 240, 6,
+	7, 6, 7, 6, 7, 241, 242, 243,
+	244, 0, 6, 7, 0, 6, 7, 0,
+	0, 0, 0, 0, 0, 0, 245, 245,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 0,
+	0, 0, 0, 6, 7, 6, 7, 0,
+	0, 0, 6, 7, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	246, 246, 246, 246, 246, 246, 246, 246,
+	246, 246, 246, 246, 246, 246, 246, 246,
+	246, 246, 246, 246, 246, 246, 246, 246,
+	246, 246, 246, 246, 246, 246, 246, 246,
+	246, 246, 246, 246, 246, 246, 0, 246,
+	0, 0, 0, 0, 0, 246, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 7, 6, 7, 247, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 0, 6, 7, 248, 0, 0,
+	6, 7, 6, 7, 249, 0, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 250, 251, 252, 253, 250, 0,
+	254, 255, 256, 257, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 258, 259, 260, 6,
+	7, 6, 7, 261, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 262, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6, 7, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 263, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	265, 266, 267, 268, 269, 270, 271, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 272, 273, 274, 275, 276,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 0, 0, 0, 0,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279,
+	279, 279, 279, 0, 279, 279, 279, 279,
+	279, 279, 279, 279, 279, 279, 279, 279,
+	279, 279, 279, 0, 279, 279, 279, 279,
+	279, 279, 279, 0, 279, 279, 0, 280,
+	280, 280, 280, 280, 280, 280, 280, 280,
+	280, 280, 0, 280, 280, 280, 280, 280,
+	280, 280, 280, 280, 280, 280, 280, 280,
+	280, 280, 0, 280, 280, 280, 280, 280,
+	280, 280, 0, 280, 280, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	83, 83, 83, 83, 83, 83, 83, 83,
+	83, 83, 83, 83, 83, 83, 83, 83,
+	83, 83, 83, 83, 83, 83, 83, 83,
+	83, 83, 83, 83, 83, 83, 83, 83,
+	83, 83, 83, 83, 83, 83, 83, 83,
+	83, 83, 83, 83, 83, 83, 83, 83,
+	83, 83, 83, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	281, 281, 281, 281, 281, 281, 281, 281,
+	281, 281, 281, 281, 281, 281, 281, 281,
+	281, 281, 281, 281, 281, 281, 281, 281,
+	281, 0, 0, 282, 282, 282, 282, 282,
+	282, 282, 282, 282, 282, 282, 282, 282,
+	282, 282, 282, 282, 282, 282, 282, 282,
+	282, 282, 282, 282, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 284, 284, 284, 284, 284, 284,
+	284, 284, 284, 284, 284, 284, 284, 284,
+	284, 284, 284, 284, 284, 284, 284, 284,
+	284, 284, 284, 284, 284, 284, 284, 284,
+	284, 284, 284, 284, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const int_least32_t upper_offset[] = {
+	0, 0, -32, 743, 1114112, 121, 0, -1,
+	1114113, -232, 1114127, 0, -300, 195, 0, 0,
+	0, 0, 0, 0, 0, 97, 0, 0,
+	163, 42561, 0, 130, 0, 0, 0, 0,
+	56, 0, -1, -2, -79, 1114130, 0, 0,
+	0, 0, 0, 0, 10815, 0, 0, 0,
+	10783, 10780, 10782, -210, -206, -205, -202, -203,
+	42319, 42315, -207, 42343, 42280, 42308, -209, -211,
+	10743, 42305, 10749, -213, -214, 10727, -218, 42307,
+	42282, -69, -217, -71, -219, 42261, 42258, 84,
+	0, 0, 0, 0, 0, 1114128, -38, -37,
+	1114129, -31, -64, -63, 0, -62, -57, -47,
+	-54, -8, -86, -80, 7, -116, 0, -96,
+	0, 0, 0, -15, 0, -48, 1114121, 0,
+	3008, 0, -6254, -6253, -6244, -6242, -6243, -6236,
+	-6181, 35266, 0, 35332, 3814, 35384, 1114131, 1114132,
+	1114133, 1114134, 1114135, -59, 0, 8, 0, 1114136,
+	1114137, 1114138, 1114139, 74, 86, 100, 128, 112,
+	126, 1114152, 1114153, 1114154, 1114155, 1114156, 1114157, 1114158,
+	1114159, 1114160, 1114161, 1114162, 1114163, 1114164, 1114165, 1114166,
+	1114167, 1114168, 1114169, 1114170, 1114171, 1114172, 1114173, 1114174,
+	1114175, 1114176, 1114177, 1114178, 1114179, 1114180, 1114181, 1114182,
+	1114183, 1114184, 1114185, 1114186, 1114187, 1114188, 1114189, 1114190,
+	1114191, 1114192, 1114193, 1114194, 1114195, 1114196, 1114197, 1114198,
+	1114199, 1114206, 1114200, 1114207, 1114140, 1114212, 0, 1114201,
+	-7205, 1114208, 1114202, 1114209, 1114141, 1114213, 0, 1114203,
+	1114142, 1114143, 1114144, 1114145, 0, 1114146, 1114147, 1114148,
+	1114149, 1114150, 0, 1114210, 1114204, 1114211, 1114151, 1114214,
+	0, 0, 1114205, 0, 0, 0, 0, -28,
+	0, -16, 0, -26, 0, 0, 0, -10795,
+	-10792, 0, 0, 0, 0, 0, -7264, 0,
+	0, 48, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, -928,
+	-38864, 1114114, 1114115, 1114116, 1114117, 1114118, 1114119, 1114120,
+	1114122, 1114123, 1114124, 1114125, 1114126, 0, -40, 0,
+	-39, 0, -27, 0, -34
+};
+
+static const int_least32_t lower_offset[] = {
+	0, 32, 0, 0, 1114112, 0, 1, 0,
+	1114113, 0, 1114127, -121, 0, 0, 210, 206,
+	205, 79, 202, 203, 207, 0, 211, 209,
+	0, 0, 213, 0, 214, 218, 217, 219,
+	0, 2, 1, 0, 0, 1114130, -97, -56,
+	-130, 10795, -163, 10792, 0, -195, 69, 71,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	116, 38, 37, 64, 63, 1114128, 0, 0,
+	1114129, 0, 0, 0, 8, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, -60, 0,
+	-7, 80, 15, 0, 48, 0, 1114121, 7264,
+	0, 38864, 0, 0, 0, 0, 0, 0,
+	0, 0, -3008, 0, 0, 0, 1114131, 1114132,
+	1114133, 1114134, 1114135, 0, -7615, 0, -8, 1114136,
+	1114137, 1114138, 1114139, 0, 0, 0, 0, 0,
+	0, 1114152, 1114153, 1114154, 1114155, 1114156, 1114157, 1114158,
+	1114159, 1114160, 1114161, 1114162, 1114163, 1114164, 1114165, 1114166,
+	1114167, 1114168, 1114169, 1114170, 1114171, 1114172, 1114173, 1114174,
+	1114175, 1114176, 1114177, 1114178, 1114179, 1114180, 1114181, 1114182,
+	1114183, 1114184, 1114185, 1114186, 1114187, 1114188, 1114189, 1114190,
+	1114191, 1114192, 1114193, 1114194, 1114195, 1114196, 1114197, 1114198,
+	1114199, 1114206, 1114200, 1114207, 1114140, 1114212, -74, 1114201,
+	0, 1114208, 1114202, 1114209, 1114141, 1114213, -86, 1114203,
+	1114142, 1114143, 1114144, 1114145, -100, 1114146, 1114147, 1114148,
+	1114149, 1114150, -112, 1114210, 1114204, 1114211, 1114151, 1114214,
+	-128, -126, 1114205, -7517, -8383, -8262, 28, 0,
+	16, 0, 26, 0, -10743, -3814, -10727, 0,
+	0, -10780, -10749, -10783, -10782, -10815, 0, -35332,
+	-42280, 0, -42308, -42319, -42315, -42305, -42258, -42282,
+	-42261, 928, -48, -42307, -35384, -42343, -42561, 0,
+	0, 1114114, 1114115, 1114116, 1114117, 1114118, 1114119, 1114120,
+	1114122, 1114123, 1114124, 1114125, 1114126, 40, 0, 39,
+	0, 27, 0, 34, 0
+};
+
+static const int_least32_t title_offset[] = {
+	0, 0, -32, 743, 1114112, 121, 0, -1,
+	1114113, -232, 1114127, 0, -300, 195, 0, 0,
+	0, 0, 0, 0, 0, 97, 0, 0,
+	163, 42561, 0, 130, 0, 0, 0, 0,
+	56, 1, 0, -1, -79, 1114130, 0, 0,
+	0, 0, 0, 0, 10815, 0, 0, 0,
+	10783, 10780, 10782, -210, -206, -205, -202, -203,
+	42319, 42315, -207, 42343, 42280, 42308, -209, -211,
+	10743, 42305, 10749, -213, -214, 10727, -218, 42307,
+	42282, -69, -217, -71, -219, 42261, 42258, 84,
+	0, 0, 0, 0, 0, 1114128, -38, -37,
+	1114129, -31, -64, -63, 0, -62, -57, -47,
+	-54, -8, -86, -80, 7, -116, 0, -96,
+	0, 0, 0, -15, 0, -48, 1114121, 0,
+	0, 0, -6254, -6253, -6244, -6242, -6243, -6236,
+	-6181, 35266, 0, 35332, 3814, 35384, 1114131, 1114132,
+	1114133, 1114134, 1114135, -59, 0, 8, 0, 1114136,
+	1114137, 1114138, 1114139, 74, 86, 100, 128, 112,
+	126, 1114152, 1114153, 1114154, 1114155, 1114156, 1114157, 1114158,
+	1114159, 1114160, 1114161, 1114162, 1114163, 1114164, 1114165, 1114166,
+	1114167, 1114168, 1114169, 1114170, 1114171, 1114172, 1114173, 1114174,
+	1114175, 1114176, 1114177, 1114178, 1114179, 1114180, 1114181, 1114182,
+	1114183, 1114184, 1114185, 1114186, 1114187, 1114188, 1114189, 1114190,
+	1114191, 1114192, 1114193, 1114194, 1114195, 1114196, 1114197, 1114198,
+	1114199, 1114206, 1114200, 1114207, 1114140, 1114212, 0, 1114201,
+	-7205, 1114208, 1114202, 1114209, 1114141, 1114213, 0, 1114203,
+	1114142, 1114143, 1114144, 1114145, 0, 1114146, 1114147, 1114148,
+	1114149, 1114150, 0, 1114210, 1114204, 1114211, 1114151, 1114214,
+	0, 0, 1114205, 0, 0, 0, 0, -28,
+	0, -16, 0, -26, 0, 0, 0, -10795,
+	-10792, 0, 0, 0, 0, 0, -7264, 0,
+	0, 48, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, -928,
+	-38864, 1114114, 1114115, 1114116, 1114117, 1114118, 1114119, 1114120,
+	1114122, 1114123, 1114124, 1114125, 1114126, 0, -40, 0,
+	-39, 0, -27, 0, -34
+};
+
+static const struct special_case upper_special[] = {
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000053), UINT32_C(0x000053) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000130) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000046) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000049) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x00004C) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000046), UINT32_C(0x000049) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000046), UINT32_C(0x00004C) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000053), UINT32_C(0x000054) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000053), UINT32_C(0x000054) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000535), UINT32_C(0x000552) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x000546) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x000535) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x00053B) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00054E), UINT32_C(0x000546) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x00053D) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0002BC), UINT32_C(0x00004E) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00004A), UINT32_C(0x00030C) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000048), UINT32_C(0x000331) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000054), UINT32_C(0x000308) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000057), UINT32_C(0x00030A) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000059), UINT32_C(0x00030A) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0002BE) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313), UINT32_C(0x000300) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313), UINT32_C(0x000342) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000391), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000397), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000342) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A1), UINT32_C(0x000313) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000342) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A9), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F08), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F09), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0A), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0B), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0C), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0D), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0E), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F08), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F09), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0A), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0B), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0C), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0D), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0E), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F0F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F28), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F29), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2A), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2B), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2C), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2D), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2E), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F28), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F29), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2A), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2B), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2C), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2D), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2E), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F2F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F68), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F69), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6A), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6B), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6C), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6D), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6E), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F68), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F69), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6A), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6B), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6C), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6D), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6E), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F6F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000391), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000391), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000397), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000397), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A9), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A9), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FBA), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000386), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FCA), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000389), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FFA), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00038F), UINT32_C(0x000399) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000391), UINT32_C(0x000342), UINT32_C(0x000399) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000397), UINT32_C(0x000342), UINT32_C(0x000399) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A9), UINT32_C(0x000342), UINT32_C(0x000399) },
+		.cplen  = 3,
+	},
+};
+
+static const struct special_case lower_special[] = {
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000DF) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000069), UINT32_C(0x000307) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB00) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB01) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB02) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB03) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB04) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB05) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB06) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000587) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB13) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB14) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB15) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB16) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00FB17) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000149) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000390) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003B0) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001F0) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001E96) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001E97) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001E98) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001E99) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001E9A) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F50) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F52) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F54) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F56) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FB6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FC6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FD2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FD3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FD6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FD7) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FE2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FE3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FE4) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FE6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FE7) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FF6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F80) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F81) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F82) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F83) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F84) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F85) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F86) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F87) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F80) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F81) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F82) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F83) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F84) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F85) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F86) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F87) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F90) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F91) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F92) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F93) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F94) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F95) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F96) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F97) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F90) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F91) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F92) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F93) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F94) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F95) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F96) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F97) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA0) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA1) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA4) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA5) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA7) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA0) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA1) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA4) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA5) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA6) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA7) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FB3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FB3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FC3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FC3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FF3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FF3) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FB2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FB4) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FC2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FC4) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FF2) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FF4) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FB7) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FC7) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FF7) },
+		.cplen  = 1,
+	},
+};
+
+static const struct special_case title_special[] = {
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000053), UINT32_C(0x000073) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000130) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000066) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000069) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x00006C) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000066), UINT32_C(0x000069) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000046), UINT32_C(0x000066), UINT32_C(0x00006C) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000053), UINT32_C(0x000074) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000053), UINT32_C(0x000074) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000535), UINT32_C(0x000582) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x000576) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x000565) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x00056B) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00054E), UINT32_C(0x000576) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000544), UINT32_C(0x00056D) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0002BC), UINT32_C(0x00004E) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00004A), UINT32_C(0x00030C) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000048), UINT32_C(0x000331) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000054), UINT32_C(0x000308) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000057), UINT32_C(0x00030A) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000059), UINT32_C(0x00030A) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0002BE) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313), UINT32_C(0x000300) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000313), UINT32_C(0x000342) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000391), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000397), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000399), UINT32_C(0x000308), UINT32_C(0x000342) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000301) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A1), UINT32_C(0x000313) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A5), UINT32_C(0x000308), UINT32_C(0x000342) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A9), UINT32_C(0x000342) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F88) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F89) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8A) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8B) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8C) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8D) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8E) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8F) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F88) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F89) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8A) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8B) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8C) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8D) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8E) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F8F) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F98) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F99) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9A) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9B) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9C) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9D) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9E) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9F) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F98) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F99) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9A) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9B) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9C) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9D) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9E) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001F9F) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA8) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA9) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAA) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAB) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAD) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAE) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAF) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA8) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FA9) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAA) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAB) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAD) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAE) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FAF) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FBC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FBC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FCC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FCC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FFC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FFC) },
+		.cplen  = 1,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FBA), UINT32_C(0x000345) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000386), UINT32_C(0x000345) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FCA), UINT32_C(0x000345) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000389), UINT32_C(0x000345) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001FFA), UINT32_C(0x000345) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00038F), UINT32_C(0x000345) },
+		.cplen  = 2,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000391), UINT32_C(0x000342), UINT32_C(0x000345) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000397), UINT32_C(0x000342), UINT32_C(0x000345) },
+		.cplen  = 3,
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0003A9), UINT32_C(0x000342), UINT32_C(0x000345) },
+		.cplen  = 3,
+	},
+};
+
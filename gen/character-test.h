@@ -0,0 +1,5370 @@
+/* Automatically generated by gen/character-test */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../gen/types.h"
+
+static const struct break_test character_break_test[] = {
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (Control) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00094D), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200C), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [12.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0006DD), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC END OF AYAH (Prepend) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000903), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI SIGN VISARGA (SpacingMark) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [6.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [6.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [6.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [6.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [7.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [7.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001160), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JUNGSEONG FILLER (V) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [8.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0011A8), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL JONGSEONG KIYEOK (T) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [7.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [7.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [8.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [5.0] <NULL> (Control) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00094D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00094D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING GRAVE ACCENT (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00200C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00200C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH NON-JOINER (ExtendmConjunctLinkermConjunctExtender) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x0006DD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x0006DD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] ARABIC END OF AYAH (Prepend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000903) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x000903) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x001160) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x001160) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JUNGSEONG FILLER (V) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x0011A8) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x0011A8) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL JONGSEONG KIYEOK (T) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00AC00) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00AC00) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GA (LV) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x00AC01) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x00AC01) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] HANGUL SYLLABLE GAG (LVT) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000915) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x000915) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] COPYRIGHT SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000378) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000378), UINT32_C(0x000308), UINT32_C(0x000378) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <reserved-0378> (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] <reserved-0378> (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x00000A), UINT32_C(0x000308) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [5.0] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00200D), UINT32_C(0x000646) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] ARABIC LETTER NOON (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000646), UINT32_C(0x00200D), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC LETTER NOON (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] SPACE (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001100), UINT32_C(0x001100) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HANGUL CHOSEONG KIYEOK (L) × [6.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC00), UINT32_C(0x0011A8), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GA (LV) × [7.0] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00AC01), UINT32_C(0x0011A8), UINT32_C(0x001100) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HANGUL SYLLABLE GAG (LVT) × [8.0] HANGUL JONGSEONG KIYEOK (T) ÷ [999.0] HANGUL CHOSEONG KIYEOK (L) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [12.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [13.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x00200D), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [13.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x00200D), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 2, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) × [13.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x01F1E9), UINT32_C(0x000062) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 2, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [13.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) × [13.0] REGIONAL INDICATOR SYMBOL LETTER D (RI) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000062) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000903), UINT32_C(0x000062) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.1] DEVANAGARI SIGN VISARGA (SpacingMark) ÷ [999.0] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000600), UINT32_C(0x000062) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [999.0] ARABIC NUMBER SIGN (Prepend) × [9.2] LATIN SMALL LETTER B (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F476), UINT32_C(0x01F3FF), UINT32_C(0x01F476) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] BABY (ExtPict) × [9.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] BABY (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F3FF), UINT32_C(0x01F476) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] BABY (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F3FF), UINT32_C(0x01F476), UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] BABY (ExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) × [11.0] OCTAGONAL SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F476), UINT32_C(0x01F3FF), UINT32_C(0x000308), UINT32_C(0x00200D), UINT32_C(0x01F476), UINT32_C(0x01F3FF) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] BABY (ExtPict) × [9.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend_ConjunctExtendermConjunctLinker) × [9.0] COMBINING DIAERESIS (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) × [11.0] BABY (ExtPict) × [9.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F6D1), UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] OCTAGONAL SIGN (ExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) × [11.0] OCTAGONAL SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] OCTAGONAL SIGN (ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002701), UINT32_C(0x00200D), UINT32_C(0x002701) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] UPPER BLADE SCISSORS (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] UPPER BLADE SCISSORS (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00200D), UINT32_C(0x002701) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] UPPER BLADE SCISSORS (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x000924) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) ÷ [999.0] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D), UINT32_C(0x000924) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D), UINT32_C(0x00094D), UINT32_C(0x000924) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D), UINT32_C(0x00200D), UINT32_C(0x000924) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00093C), UINT32_C(0x00200D), UINT32_C(0x00094D), UINT32_C(0x000924) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN NUKTA (Extend_ConjunctExtendermConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00093C), UINT32_C(0x00094D), UINT32_C(0x00200D), UINT32_C(0x000924) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN NUKTA (Extend_ConjunctExtendermConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] ZERO WIDTH JOINER (ZWJ) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D), UINT32_C(0x000924), UINT32_C(0x00094D), UINT32_C(0x00092F) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] DEVANAGARI LETTER YA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00094D), UINT32_C(0x000924) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (XXmLinkingConsonantmExtPict) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003F), UINT32_C(0x00094D), UINT32_C(0x000924) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUESTION MARK (XXmLinkingConsonantmExtPict) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) ÷ [999.0] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000915), UINT32_C(0x00094D), UINT32_C(0x00094D), UINT32_C(0x000924) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DEVANAGARI LETTER KA (LinkingConsonant) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.0] DEVANAGARI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] DEVANAGARI LETTER TA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000AB8), UINT32_C(0x000AFB), UINT32_C(0x000ACD), UINT32_C(0x000AB8), UINT32_C(0x000AFB) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] GUJARATI LETTER SA (LinkingConsonant) × [9.0] GUJARATI SIGN SHADDA (Extend_ConjunctExtendermConjunctLinker) × [9.0] GUJARATI SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] GUJARATI LETTER SA (LinkingConsonant) × [9.0] GUJARATI SIGN SHADDA (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001019), UINT32_C(0x001039), UINT32_C(0x001018), UINT32_C(0x00102C), UINT32_C(0x001037) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] MYANMAR LETTER MA (LinkingConsonant) × [9.0] MYANMAR SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] MYANMAR LETTER BHA (LinkingConsonant) ÷ [999.0] MYANMAR VOWEL SIGN AA (XXmLinkingConsonantmExtPict) × [9.0] MYANMAR SIGN DOT BELOW (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001004), UINT32_C(0x00103A), UINT32_C(0x001039), UINT32_C(0x001011), UINT32_C(0x001039), UINT32_C(0x001011) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] MYANMAR LETTER NGA (LinkingConsonant) × [9.0] MYANMAR SIGN ASAT (Extend_ConjunctExtendermConjunctLinker) × [9.0] MYANMAR SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] MYANMAR LETTER THA (LinkingConsonant) × [9.0] MYANMAR SIGN VIRAMA (Extend_ConjunctLinker) × [9.3] MYANMAR LETTER THA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001B12), UINT32_C(0x001B01), UINT32_C(0x001B32), UINT32_C(0x001B44), UINT32_C(0x001B2F), UINT32_C(0x001B32), UINT32_C(0x001B44), UINT32_C(0x001B22), UINT32_C(0x001B44), UINT32_C(0x001B2C), UINT32_C(0x001B32), UINT32_C(0x001B44), UINT32_C(0x001B22), UINT32_C(0x001B38) },
+		.cplen  = 14,
+		.len    = (size_t[]){ 2, 3, 5, 4 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] BALINESE LETTER OKARA TEDUNG (XXmLinkingConsonantmExtPict) × [9.0] BALINESE SIGN ULU CANDRA (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] BALINESE LETTER SA (LinkingConsonant) × [9.0] BALINESE ADEG ADEG (Extend_ConjunctLinker) × [9.3] BALINESE LETTER WA (LinkingConsonant) ÷ [999.0] BALINESE LETTER SA (LinkingConsonant) × [9.0] BALINESE ADEG ADEG (Extend_ConjunctLinker) × [9.3] BALINESE LETTER TA (LinkingConsonant) × [9.0] BALINESE ADEG ADEG (Extend_ConjunctLinker) × [9.3] BALINESE LETTER YA (LinkingConsonant) ÷ [999.0] BALINESE LETTER SA (LinkingConsonant) × [9.0] BALINESE ADEG ADEG (Extend_ConjunctLinker) × [9.3] BALINESE LETTER TA (LinkingConsonant) × [9.0] BALINESE VOWEL SIGN SUKU (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00179F), UINT32_C(0x0017D2), UINT32_C(0x00178F), UINT32_C(0x0017D2), UINT32_C(0x00179A), UINT32_C(0x0017B8) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] KHMER LETTER SA (LinkingConsonant) × [9.0] KHMER SIGN COENG (Extend_ConjunctLinker) × [9.3] KHMER LETTER TA (LinkingConsonant) × [9.0] KHMER SIGN COENG (Extend_ConjunctLinker) × [9.3] KHMER LETTER RO (LinkingConsonant) × [9.0] KHMER VOWEL SIGN II (Extend_ConjunctExtendermConjunctLinker) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001B26), UINT32_C(0x001B17), UINT32_C(0x001B44), UINT32_C(0x001B13) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] BALINESE LETTER NA (LinkingConsonant) ÷ [999.0] BALINESE LETTER NGA (LinkingConsonant) × [9.0] BALINESE ADEG ADEG (Extend_ConjunctLinker) × [9.3] BALINESE LETTER KA (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001B27), UINT32_C(0x001B13), UINT32_C(0x001B44), UINT32_C(0x001B0B), UINT32_C(0x001B0B), UINT32_C(0x001B04) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] BALINESE LETTER PA (LinkingConsonant) ÷ [999.0] BALINESE LETTER KA (LinkingConsonant) × [9.0] BALINESE ADEG ADEG (Extend_ConjunctLinker) × [9.3] BALINESE LETTER RA REPA (LinkingConsonant) ÷ [999.0] BALINESE LETTER RA REPA (LinkingConsonant) × [9.1] BALINESE SIGN BISAH (SpacingMark) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x001795), UINT32_C(0x0017D2), UINT32_C(0x0017AF), UINT32_C(0x001798) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] KHMER LETTER PHA (LinkingConsonant) × [9.0] KHMER SIGN COENG (Extend_ConjunctLinker) × [9.3] KHMER INDEPENDENT VOWEL QE (LinkingConsonant) ÷ [999.0] KHMER LETTER MO (LinkingConsonant) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0017A0), UINT32_C(0x0017D2), UINT32_C(0x0017AB), UINT32_C(0x001791), UINT32_C(0x0017D0), UINT32_C(0x001799) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] KHMER LETTER HA (LinkingConsonant) × [9.0] KHMER SIGN COENG (Extend_ConjunctLinker) × [9.3] KHMER INDEPENDENT VOWEL RY (LinkingConsonant) ÷ [999.0] KHMER LETTER TO (LinkingConsonant) × [9.0] KHMER SIGN SAMYOK SANNYA (Extend_ConjunctExtendermConjunctLinker) ÷ [999.0] KHMER LETTER YO (LinkingConsonant) ÷ [0.3]",
+	},
+};
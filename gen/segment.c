@@ -0,0 +1,88 @@
+/* See LICENSE file for copyright and license details. */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "character.h"
+#include "line.h"
+#include "sentence.h"
+#include "util.h"
+#include "word.h"
+
+/*
+ * The segmentation properties of a codepoint are looked up in four
+ * separate tables, one for each segmentation. When multiple
+ * segmentations are determined on the same text, this touches four
+ * cache footprints per codepoint. Here we combine the already
+ * generated tables into a single one that maps each codepoint to a
+ * record holding all four properties. It is defined once in the
+ * library (see src/util.c) and shared by all segmentations.
+ */
+static int_least64_t
+get_packed_properties(uint_least32_t cp)
+{
+	return (int_least64_t)char_break_minor[char_break_major[cp >> 8] +
+	                                       (cp & 0xff)] |
+	       (int_least64_t)word_break_minor[word_break_major[cp >> 8] +
+	                                       (cp & 0xff)]
+	               << 8 |
+	       (int_least64_t)sentence_break_minor
+	                       [sentence_break_major[cp >> 8] + (cp & 0xff)]
+	               << 16 |
+	       (int_least64_t)line_break_minor[line_break_major[cp >> 8] +
+	                                       (cp & 0xff)]
+	               << 24;
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct properties_compressed comp;
+	struct properties_major_minor mm;
+	struct properties *prop;
+	size_t i;
+
+	(void)argc;
+
+	if (!(prop = calloc(UINT32_C(0x110000), sizeof(*prop)))) {
+		fprintf(stderr, "calloc: %s\n", strerror(errno));
+		exit(1);
+	}
+	for (i = 0; i < UINT32_C(0x110000); i++) {
+		prop[i].property = get_packed_properties((uint_least32_t)i);
+	}
+
+	/* compress data */
+	printf("/* Automatically generated by %s */\n#include <stdint.h>\n\n"
+	       "#include \"types.h\"\n\n",
+	       argv[0]);
+	properties_compress(prop, &comp);
+
+	fprintf(stderr, "%s: segment-LUT compression-ratio: %.2f%%\n", argv[0],
+	        properties_get_major_minor(&comp, &mm));
+
+	/* print data */
+	printf("const struct segment_properties segment_data[] = {\n");
+	for (i = 0; i < comp.datalen; i++) {
+		printf("\t{ %d, %d, %d, %d },\n",
+		       (int)(comp.data[i].property & 0xff),
+		       (int)((comp.data[i].property >> 8) & 0xff),
+		       (int)((comp.data[i].property >> 16) & 0xff),
+		       (int)((comp.data[i].property >> 24) & 0xff));
+	}
+	printf("};\n\n");
+	properties_print_shared_lookup_table("segment_major", mm.major, 0x1100);
+	printf("\n");
+	properties_print_shared_lookup_table("segment_minor", mm.minor,
+	                                     mm.minorlen);
+
+	/* free data */
+	free(prop);
+	free(comp.data);
+	free(comp.offset);
+	free(mm.major);
+	free(mm.minor);
+
+	return 0;
+}
@@ -0,0 +1,5968 @@
+/* Automatically generated by gen/segment */
+#include <stdint.h>
+
+#include "types.h"
+
+const struct segment_properties segment_data[] = {
+	{ 4, 0, 0, 10 },
+	{ 4, 0, 6, 4 },
+	{ 16, 11, 2, 28 },
+	{ 4, 15, 6, 6 },
+	{ 5, 3, 1, 13 },
+	{ 0, 19, 6, 38 },
+	{ 0, 0, 13, 16 },
+	{ 0, 4, 14, 36 },
+	{ 0, 0, 0, 0 },
+	{ 0, 0, 0, 35 },
+	{ 0, 0, 0, 34 },
+	{ 0, 18, 14, 36 },
+	{ 0, 0, 14, 32 },
+	{ 0, 0, 14, 11 },
+	{ 0, 13, 12, 24 },
+	{ 0, 0, 12, 21 },
+	{ 0, 14, 11, 24 },
+	{ 0, 0, 0, 39 },
+	{ 0, 16, 10, 31 },
+	{ 0, 12, 12, 24 },
+	{ 0, 1, 8, 0 },
+	{ 0, 7, 0, 0 },
+	{ 0, 1, 7, 0 },
+	{ 0, 0, 0, 4 },
+	{ 0, 0, 14, 9 },
+	{ 4, 15, 4, 29 },
+	{ 0, 0, 6, 17 },
+	{ 0, 0, 0, 32 },
+	{ 7, 6, 0, 0 },
+	{ 0, 0, 14, 36 },
+	{ 4, 8, 5, 4 },
+	{ 0, 0, 0, 5 },
+	{ 0, 12, 0, 0 },
+	{ 0, 1, 0, 0 },
+	{ 0, 1, 9, 0 },
+	{ 0, 1, 9, 5 },
+	{ 0, 1, 0, 5 },
+	{ 1, 5, 3, 10 },
+	{ 1, 5, 3, 17 },
+	{ 0, 0, 12, 0 },
+	{ 0, 13, 13, 24 },
+	{ 0, 0, 0, 16 },
+	{ 0, 9, 9, 20 },
+	{ 17, 16, 10, 31 },
+	{ 4, 8, 5, 10 },
+	{ 0, 13, 10, 31 },
+	{ 0, 0, 13, 0 },
+	{ 17, 1, 5, 0 },
+	{ 19, 5, 3, 10 },
+	{ 13, 1, 9, 0 },
+	{ 2, 5, 3, 10 },
+	{ 0, 0, 13, 4 },
+	{ 17, 1, 9, 0 },
+	{ 0, 0, 9, 0 },
+	{ 1, 5, 3, 0 },
+	{ 19, 0, 9, 0 },
+	{ 0, 0, 0, 17 },
+	{ 19, 5, 3, 4 },
+	{ 13, 0, 9, 0 },
+	{ 0, 5, 3, 0 },
+	{ 19, 5, 3, 0 },
+	{ 2, 5, 3, 0 },
+	{ 8, 1, 9, 25 },
+	{ 9, 1, 9, 27 },
+	{ 10, 1, 9, 26 },
+	{ 0, 19, 6, 4 },
+	{ 0, 0, 0, 30 },
+	{ 0, 0, 12, 16 },
+	{ 4, 8, 5, 17 },
+	{ 0, 16, 10, 0 },
+	{ 0, 0, 0, 22 },
+	{ 4, 0, 5, 41 },
+	{ 6, 5, 3, 10 },
+	{ 3, 20, 3, 42 },
+	{ 0, 0, 12, 3 },
+	{ 0, 14, 14, 36 },
+	{ 0, 14, 11, 23 },
+	{ 0, 0, 0, 23 },
+	{ 0, 12, 0, 4 },
+	{ 4, 15, 4, 6 },
+	{ 0, 7, 6, 17 },
+	{ 7, 6, 13, 30 },
+	{ 0, 0, 13, 30 },
+	{ 0, 13, 0, 24 },
+	{ 4, 8, 5, 40 },
+	{ 4, 8, 5, 0 },
+	{ 4, 0, 0, 0 },
+	{ 7, 2, 7, 0 },
+	{ 7, 6, 0, 22 },
+	{ 0, 0, 14, 33 },
+	{ 7, 2, 8, 0 },
+	{ 7, 6, 0, 14 },
+	{ 7, 6, 0, 16 },
+	{ 0, 0, 0, 3 },
+	{ 0, 0, 12, 9 },
+	{ 0, 0, 13, 9 },
+	{ 0, 1, 9, 30 },
+	{ 0, 0, 9, 22 },
+	{ 0, 10, 9, 22 },
+	{ 0, 10, 9, 10 },
+	{ 0, 0, 9, 30 },
+	{ 0, 10, 0, 30 },
+	{ 0, 10, 9, 30 },
+	{ 0, 1, 9, 22 },
+	{ 0, 10, 0, 22 },
+	{ 0, 1, 9, 4 },
+	{ 11, 1, 9, 18 },
+	{ 12, 1, 9, 19 },
+	{ 0, 12, 12, 30 },
+	{ 0, 0, 12, 30 },
+	{ 0, 0, 12, 22 },
+	{ 0, 7, 0, 22 },
+	{ 0, 13, 12, 9 },
+	{ 0, 14, 11, 9 },
+	{ 0, 13, 12, 30 },
+	{ 0, 14, 0, 22 },
+	{ 0, 16, 10, 22 },
+	{ 0, 1, 8, 22 },
+	{ 0, 1, 7, 22 },
+	{ 1, 5, 3, 30 },
+	{ 0, 0, 0, 8 },
+	{ 0, 0, 13, 22 },
+	{ 0, 1, 9, 32 },
+	{ 0, 1, 9, 9 },
+	{ 4, 8, 5, 32 },
+	{ 4, 8, 5, 9 },
+	{ 9, 1, 9, 0 },
+	{ 0, 10, 9, 0 },
+	{ 7, 6, 0, 7 },
+	{ 18, 17, 0, 37 },
+	{ 1, 5, 0, 15 },
+};
+
+const uint_least16_t segment_major[] = {
+	0, 256, 512, 768, 1024, 1280, 1536, 1792,
+	2048, 2304, 2560, 2816, 3072, 3328, 3584, 3840,
+	4096, 4352, 4608, 4864, 5120, 5376, 5632, 5888,
+	6144, 6400, 6656, 6912, 7168, 7424, 7680, 7936,
+	8192, 8448, 8704, 8960, 9216, 9472, 9728, 9984,
+	10240, 10496, 10241, 10752, 11008, 11264, 11520, 11776,
+	12032, 12288, 12544, 12800, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13312, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13568, 13824, 13590, 13590, 14080, 5121, 14336, 14592,
+	14848, 15104, 15360, 15616, 15872, 16128, 15880, 15884,
+	15888, 15892, 15896, 15872, 15876, 15880, 15884, 15888,
+	15892, 15896, 15872, 15876, 15880, 15884, 15888, 15892,
+	15896, 15872, 15876, 15880, 15884, 15888, 15892, 15896,
+	15872, 15876, 15880, 15884, 15888, 15892, 15896, 15872,
+	15876, 15880, 15884, 15888, 15892, 15896, 15872, 16384,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 13056, 16640, 16896, 5121, 17152, 17408, 17664,
+	17920, 18176, 18432, 18688, 18944, 19200, 5121, 19456,
+	19712, 19968, 20224, 20480, 20736, 20992, 21248, 21504,
+	21760, 22016, 22272, 22528, 22784, 23040, 23296, 23552,
+	23808, 24064, 24320, 24576, 24832, 25088, 25344, 25600,
+	5121, 5121, 5121, 25856, 26112, 26368, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 26624,
+	5121, 5121, 26880, 27136, 27392, 5121, 5121, 5121,
+	5121, 5121, 5121, 5121, 5121, 5121, 5121, 5121,
+	5121, 5121, 5121, 27648, 5121, 27904, 26365, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 28160, 10241, 10241, 10241, 10241, 10241, 10241,
+	5121, 5121, 28416, 28672, 10241, 28928, 29184, 29440,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 29696, 29952, 30208, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 30464,
+	30720, 30976, 13252, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 31232, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 31488, 10241, 10241, 31744,
+	10241, 32000, 32256, 10241, 32512, 32768, 33024, 33280,
+	10241, 10241, 33536, 10241, 10241, 10241, 10241, 33792,
+	34048, 34304, 34560, 10241, 34816, 35072, 35328, 35584,
+	35840, 36096, 10241, 10241, 36352, 10241, 36608, 10241,
+	36864, 37120, 37376, 37632, 37888, 38144, 38400, 38656,
+	38912, 39168, 39424, 31488, 39680, 39673, 39673, 39936,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13280, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	40192, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 40448, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 40704, 13056, 13056, 30357, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	13056, 13056, 30421, 10241, 10241, 10241, 10241, 10241,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 40960, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 13056, 13056, 13056, 13056,
+	13056, 13056, 13056, 13056, 41216, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	41472, 41728, 41984, 41968, 41968, 41968, 41968, 41968,
+	41968, 41968, 41968, 41968, 41968, 41968, 41968, 41968,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241,
+	10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241
+};
+
+const uint_least8_t segment_minor[] = {
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 2, 3, 3, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	5, 6, 7, 8, 9, 10, 8, 11,
+	12, 13, 8, 9, 14, 15, 16, 17,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 19, 14, 8, 8, 8, 6,
+	8, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 12, 9, 13, 8, 21,
+	8, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 12, 23, 24, 8, 0,
+	0, 0, 0, 0, 0, 25, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	26, 27, 10, 9, 9, 9, 8, 8,
+	8, 28, 22, 29, 8, 30, 28, 8,
+	10, 9, 8, 8, 31, 22, 8, 32,
+	33, 8, 22, 29, 8, 8, 8, 27,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 8,
+	20, 20, 20, 20, 20, 20, 20, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 20, 22, 20, 22, 20, 22, 20,
+	22, 20, 22, 20, 22, 20, 22, 20,
+	22, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 20, 22, 20, 22, 20, 22, 22,
+	22, 20, 20, 22, 20, 22, 20, 20,
+	22, 20, 20, 20, 22, 22, 20, 20,
+	20, 20, 22, 20, 20, 22, 20, 20,
+	20, 22, 22, 22, 20, 20, 22, 20,
+	20, 22, 20, 22, 20, 22, 20, 20,
+	22, 20, 22, 22, 20, 22, 20, 20,
+	22, 20, 20, 20, 22, 20, 22, 20,
+	20, 22, 22, 34, 20, 22, 22, 22,
+	34, 34, 34, 34, 20, 20, 22, 20,
+	20, 22, 20, 20, 22, 20, 22, 20,
+	22, 20, 22, 20, 22, 20, 22, 20,
+	22, 20, 22, 20, 22, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 20, 20, 22, 20, 22, 20, 20,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 22, 22, 22, 22,
+	22, 22, 20, 20, 22, 20, 20, 22,
+	22, 20, 22, 20, 20, 20, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 34, 34, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 34, 34, 34, 34, 34, 34, 34,
+	22, 22, 33, 33, 33, 33, 34, 34,
+	35, 34, 34, 34, 35, 34, 34, 34,
+	34, 34, 33, 33, 33, 33, 33, 33,
+	8, 8, 8, 8, 8, 8, 33, 36,
+	22, 22, 22, 22, 22, 33, 33, 33,
+	33, 33, 33, 33, 34, 33, 34, 33,
+	33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 38, 38, 38, 38,
+	38, 38, 38, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	20, 22, 20, 22, 34, 8, 20, 22,
+	8, 8, 22, 22, 22, 22, 14, 20,
+	8, 8, 8, 8, 8, 8, 20, 32,
+	20, 20, 20, 8, 20, 8, 20, 20,
+	22, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 8, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 20,
+	22, 22, 20, 20, 20, 22, 22, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 22, 22, 22, 20, 22, 8, 20,
+	22, 20, 20, 22, 22, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 8, 37, 37, 37, 37, 37,
+	37, 37, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 20, 22, 20, 22, 20, 22, 20,
+	22, 20, 22, 20, 22, 20, 22, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	8, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 8,
+	8, 34, 33, 33, 33, 39, 33, 32,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 40, 33, 8, 8, 8, 8, 9,
+	8, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 8, 37,
+	8, 37, 37, 8, 37, 37, 41, 37,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 8, 8, 8, 8, 42,
+	42, 42, 42, 34, 32, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	43, 43, 43, 43, 43, 43, 8, 8,
+	8, 10, 10, 10, 14, 14, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 41, 44, 6, 6, 6,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 10, 18, 45, 8, 34, 34,
+	37, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 6, 34, 37, 37,
+	37, 37, 37, 37, 37, 43, 8, 37,
+	37, 37, 37, 37, 37, 34, 34, 37,
+	37, 8, 37, 37, 37, 37, 34, 34,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 34, 34, 8, 8, 34,
+	46, 46, 46, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 47,
+	34, 37, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 8, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 34, 34, 8, 8,
+	14, 6, 34, 8, 8, 37, 9, 9,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	37, 37, 34, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 34, 37, 37, 37,
+	34, 37, 37, 37, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 46,
+	8, 46, 8, 8, 8, 46, 46, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 37, 37, 37, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 34, 34, 34, 34, 34, 34, 34,
+	43, 43, 8, 8, 8, 8, 8, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 43, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 48, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 37, 48, 37, 34, 48, 48,
+	48, 37, 37, 37, 37, 37, 37, 37,
+	37, 48, 48, 48, 48, 50, 48, 48,
+	34, 37, 37, 37, 37, 37, 37, 37,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	34, 34, 37, 37, 51, 51, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 34, 34, 34, 34, 34, 34, 34,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	34, 37, 48, 48, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 34,
+	34, 8, 8, 34, 34, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 8, 8, 8, 49, 49,
+	49, 49, 8, 8, 37, 34, 37, 48,
+	48, 37, 37, 37, 37, 8, 8, 48,
+	48, 8, 8, 48, 48, 50, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 37,
+	8, 8, 8, 8, 49, 49, 8, 49,
+	34, 34, 37, 37, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	49, 49, 10, 10, 8, 8, 8, 8,
+	8, 10, 8, 9, 34, 8, 37, 8,
+	8, 37, 37, 48, 8, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 34,
+	34, 8, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 8, 34, 34, 8,
+	34, 34, 8, 8, 37, 8, 48, 48,
+	48, 37, 37, 8, 8, 8, 8, 37,
+	37, 8, 8, 37, 37, 37, 8, 8,
+	8, 37, 8, 8, 8, 8, 8, 8,
+	8, 34, 34, 34, 34, 8, 34, 8,
+	8, 8, 8, 8, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	37, 37, 34, 34, 34, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 37, 37, 48, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 34,
+	34, 34, 8, 34, 34, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 8, 49, 49, 49,
+	49, 49, 8, 8, 37, 34, 48, 48,
+	48, 37, 37, 37, 37, 37, 8, 37,
+	37, 48, 8, 48, 48, 50, 8, 8,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 37, 37, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 9, 8, 8, 8, 8, 8, 8,
+	8, 49, 37, 37, 37, 37, 37, 37,
+	8, 37, 48, 48, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 34,
+	34, 8, 8, 34, 34, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 8, 49, 49, 49,
+	49, 49, 8, 8, 37, 34, 37, 37,
+	48, 37, 37, 37, 37, 8, 8, 48,
+	48, 8, 8, 48, 48, 50, 8, 8,
+	8, 8, 8, 8, 8, 37, 37, 37,
+	8, 8, 8, 8, 49, 49, 8, 49,
+	34, 34, 37, 37, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 49, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 37, 34, 8, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 34, 34,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	8, 34, 34, 8, 34, 8, 34, 34,
+	8, 8, 8, 34, 34, 8, 8, 8,
+	34, 34, 34, 8, 8, 8, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 8, 37, 48,
+	37, 48, 48, 8, 8, 8, 48, 48,
+	48, 8, 48, 48, 48, 37, 8, 8,
+	34, 8, 8, 8, 8, 8, 8, 37,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 9, 8, 8, 8, 8, 8, 8,
+	37, 48, 48, 48, 37, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 34, 34,
+	34, 8, 34, 34, 34, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 8, 8, 37, 34, 37, 37,
+	37, 48, 48, 48, 48, 8, 37, 37,
+	37, 8, 37, 37, 37, 50, 8, 8,
+	8, 8, 8, 8, 8, 37, 37, 8,
+	49, 49, 49, 8, 34, 34, 8, 8,
+	34, 34, 37, 37, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 8, 8, 8, 8, 8, 8, 31,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 37, 48, 48, 31, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 34, 34,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 34, 34, 34,
+	34, 34, 8, 8, 37, 34, 48, 37,
+	37, 48, 37, 48, 48, 8, 37, 37,
+	37, 8, 37, 37, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 37, 37, 8,
+	8, 8, 8, 8, 34, 34, 34, 8,
+	34, 34, 37, 37, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 34, 34, 48, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 48, 48, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 34, 34,
+	34, 8, 34, 34, 34, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 37, 37, 34, 37, 48,
+	48, 37, 37, 37, 37, 8, 48, 48,
+	48, 8, 48, 48, 48, 50, 52, 8,
+	8, 8, 8, 8, 34, 34, 34, 37,
+	8, 8, 8, 8, 8, 8, 8, 34,
+	34, 34, 37, 37, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 10, 34, 34, 34, 34, 34, 34,
+	8, 37, 48, 48, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 37, 8, 8, 8, 8, 37,
+	48, 48, 37, 37, 37, 8, 37, 8,
+	48, 48, 48, 48, 48, 48, 48, 37,
+	8, 8, 8, 8, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	8, 8, 48, 48, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 54, 53, 55, 54, 54, 54, 54,
+	54, 54, 54, 8, 8, 8, 8, 9,
+	53, 53, 53, 53, 53, 53, 53, 54,
+	54, 54, 54, 54, 54, 54, 54, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 23, 23, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 53, 53, 8, 53, 8, 53, 53,
+	53, 53, 53, 8, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 8, 53, 8, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 54, 53, 55, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 53, 8, 8,
+	53, 53, 53, 53, 53, 8, 53, 8,
+	54, 54, 54, 54, 54, 54, 54, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 53, 53, 53, 53,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 31, 31, 31, 31, 8, 31, 31,
+	56, 31, 31, 23, 56, 41, 41, 41,
+	41, 41, 56, 8, 41, 8, 8, 8,
+	37, 37, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 23, 37, 8, 37,
+	8, 37, 12, 24, 12, 24, 48, 48,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	8, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 57,
+	37, 37, 37, 37, 37, 23, 37, 37,
+	34, 34, 34, 34, 34, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	8, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 8, 23, 23,
+	8, 8, 8, 8, 8, 8, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	31, 31, 23, 31, 8, 8, 8, 8,
+	8, 56, 56, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 59, 59, 54, 54, 54,
+	54, 60, 54, 54, 54, 54, 54, 54,
+	59, 61, 54, 60, 60, 54, 54, 58,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 51, 51, 8, 8, 8, 8,
+	58, 58, 58, 58, 58, 58, 60, 60,
+	54, 54, 58, 58, 58, 58, 54, 54,
+	54, 58, 59, 59, 59, 58, 58, 59,
+	59, 59, 59, 59, 59, 59, 58, 58,
+	58, 54, 54, 54, 54, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 54, 59, 60, 54, 54, 59,
+	59, 59, 59, 59, 59, 54, 58, 59,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 59, 59, 59, 54, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 8, 20,
+	8, 8, 8, 8, 8, 20, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 22, 34, 34, 34,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 37, 37, 37,
+	8, 23, 46, 8, 8, 8, 8, 46,
+	46, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 8, 8,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	8, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 46, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	65, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 12, 24, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 23, 23, 23, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 37, 37, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 37, 37, 37, 51, 51, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 37, 37, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 34, 34,
+	34, 8, 37, 37, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 54, 54, 60, 54,
+	54, 54, 54, 54, 54, 54, 60, 60,
+	60, 60, 60, 60, 60, 60, 54, 60,
+	60, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 61, 54, 51, 51, 66, 53,
+	23, 8, 23, 9, 53, 54, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 67, 6, 23, 23, 31, 8,
+	67, 6, 8, 37, 37, 37, 68, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 37, 37, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 37, 34, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	37, 37, 37, 48, 48, 48, 48, 37,
+	37, 48, 48, 48, 8, 8, 8, 8,
+	48, 48, 37, 48, 48, 48, 48, 48,
+	48, 37, 37, 37, 8, 8, 8, 8,
+	8, 8, 8, 8, 6, 6, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 8, 8,
+	53, 53, 53, 53, 53, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 8, 8, 8, 8,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 37,
+	37, 48, 48, 37, 8, 8, 8, 8,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 60, 54, 60,
+	54, 54, 54, 54, 54, 54, 54, 8,
+	61, 59, 54, 59, 59, 54, 54, 54,
+	54, 54, 54, 54, 54, 60, 60, 60,
+	60, 60, 60, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 8, 8, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 53,
+	46, 46, 46, 46, 8, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 38, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 37, 48, 34, 34, 34,
+	34, 34, 34, 49, 49, 34, 34, 34,
+	34, 34, 34, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 48, 48,
+	48, 48, 37, 37, 61, 49, 49, 49,
+	49, 49, 49, 49, 49, 8, 51, 51,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 51, 51, 70, 23, 51, 51,
+	23, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 51, 51, 51,
+	37, 37, 48, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 48, 37, 37, 37, 37, 48, 48,
+	37, 37, 37, 50, 37, 37, 49, 49,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 49, 49, 49, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 48,
+	37, 37, 48, 48, 48, 37, 48, 37,
+	37, 37, 54, 54, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 48, 48, 48, 48,
+	48, 48, 48, 48, 37, 37, 37, 37,
+	37, 37, 37, 37, 48, 48, 37, 37,
+	8, 8, 8, 51, 51, 23, 23, 23,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 34, 34, 34,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 51, 51,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 20, 22, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 8, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 48, 37, 37, 37, 37, 37, 37,
+	37, 34, 34, 34, 34, 37, 34, 34,
+	34, 34, 34, 34, 37, 34, 34, 48,
+	37, 37, 34, 8, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 38, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 38, 37, 37, 37,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	20, 20, 20, 20, 20, 20, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	20, 20, 20, 20, 20, 20, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	8, 20, 8, 20, 8, 20, 8, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 8, 22, 22,
+	20, 20, 20, 20, 20, 8, 22, 8,
+	8, 8, 22, 22, 22, 8, 22, 22,
+	20, 20, 20, 20, 20, 8, 8, 8,
+	22, 22, 22, 22, 8, 8, 22, 22,
+	20, 20, 20, 20, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 8, 8, 8,
+	8, 8, 22, 22, 22, 8, 22, 22,
+	20, 20, 20, 20, 20, 31, 8, 8,
+	65, 65, 65, 65, 65, 65, 65, 26,
+	65, 65, 65, 71, 72, 73, 44, 44,
+	8, 56, 8, 39, 74, 8, 8, 8,
+	75, 75, 12, 29, 29, 29, 12, 29,
+	8, 8, 8, 8, 76, 77, 77, 78,
+	79, 79, 44, 44, 44, 44, 44, 80,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	8, 29, 29, 8, 81, 82, 8, 21,
+	21, 8, 8, 8, 83, 12, 24, 82,
+	82, 81, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 21, 8, 23, 10,
+	23, 23, 23, 23, 8, 23, 23, 65,
+	84, 85, 85, 85, 85, 86, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44,
+	8, 22, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 12, 24, 22,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 12, 24, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 8, 8, 8,
+	9, 9, 9, 9, 9, 9, 9, 10,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 10, 9,
+	9, 9, 9, 10, 9, 9, 10, 9,
+	10, 9, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 20, 10, 8, 8, 8, 20,
+	8, 10, 22, 20, 20, 20, 22, 22,
+	20, 20, 20, 22, 8, 20, 9, 8,
+	8, 20, 20, 20, 20, 20, 8, 8,
+	8, 8, 28, 8, 20, 8, 20, 8,
+	20, 8, 20, 20, 20, 20, 8, 22,
+	20, 20, 20, 20, 22, 34, 34, 34,
+	34, 87, 8, 8, 22, 22, 20, 20,
+	8, 8, 8, 8, 8, 20, 22, 22,
+	22, 22, 8, 8, 8, 8, 22, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	34, 34, 34, 20, 22, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 28, 28, 28, 28,
+	28, 28, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 28, 28, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 9, 9, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 77,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	12, 24, 12, 24, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 88, 88, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 89, 24, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 28, 28, 28, 28, 28, 28, 28,
+	88, 88, 88, 88, 8, 8, 8, 8,
+	28, 28, 28, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 90, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 28, 28, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 28, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 28, 28, 28, 28, 8,
+	88, 88, 88, 88, 28, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 28, 8,
+	8, 28, 8, 8, 88, 88, 8, 8,
+	88, 8, 70, 70, 70, 91, 70, 70,
+	28, 8, 28, 28, 8, 8, 28, 8,
+	8, 8, 28, 8, 8, 8, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 88, 88, 70, 8, 8, 8, 8,
+	28, 8, 28, 8, 8, 8, 8, 8,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 28,
+	28, 8, 8, 28, 8, 28, 28, 8,
+	88, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 28, 8, 8, 28, 88,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 28, 28, 28, 28, 28, 28,
+	8, 28, 8, 28, 28, 8, 8, 8,
+	28, 28, 8, 8, 8, 8, 8, 28,
+	8, 8, 28, 28, 8, 8, 8, 8,
+	28, 28, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 88, 88, 70,
+	70, 70, 70, 70, 88, 88, 70, 70,
+	88, 8, 8, 8, 8, 70, 28, 88,
+	70, 88, 8, 88, 88, 8, 8, 8,
+	70, 70, 8, 8, 70, 8, 8, 70,
+	70, 70, 8, 8, 8, 8, 8, 8,
+	8, 28, 88, 8, 8, 8, 8, 8,
+	28, 88, 88, 88, 88, 88, 8, 88,
+	88, 91, 88, 8, 8, 88, 70, 70,
+	70, 70, 88, 70, 70, 28, 8, 8,
+	88, 88, 91, 91, 91, 91, 8, 28,
+	8, 8, 28, 8, 28, 8, 28, 8,
+	8, 8, 8, 8, 8, 28, 8, 8,
+	8, 28, 8, 8, 8, 8, 8, 8,
+	28, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 28, 28, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 28, 8, 8, 28,
+	8, 8, 8, 8, 28, 8, 28, 8,
+	8, 8, 8, 28, 28, 28, 8, 28,
+	8, 8, 8, 29, 29, 29, 29, 29,
+	29, 8, 41, 92, 88, 8, 8, 8,
+	12, 24, 12, 24, 12, 24, 12, 24,
+	12, 24, 12, 24, 12, 24, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 28, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 28,
+	8, 8, 8, 8, 8, 12, 24, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 12, 24,
+	12, 24, 12, 24, 12, 24, 12, 24,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	23, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 28, 28, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 12, 24, 12, 24, 12,
+	24, 12, 24, 12, 24, 12, 24, 12,
+	24, 12, 24, 12, 24, 12, 24, 12,
+	24, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	12, 24, 12, 24, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 12, 24, 8, 8,
+	8, 8, 8, 8, 8, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 28, 28, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 8, 8, 8, 8, 28, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 22, 20, 20, 20, 22, 22, 20,
+	22, 20, 22, 20, 22, 20, 20, 20,
+	20, 22, 20, 22, 22, 20, 22, 22,
+	22, 22, 22, 22, 22, 22, 20, 20,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 22, 8, 8, 8,
+	8, 8, 8, 20, 22, 20, 22, 37,
+	37, 37, 20, 22, 8, 8, 8, 8,
+	8, 6, 51, 51, 23, 8, 41, 23,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 8, 22,
+	8, 8, 8, 8, 8, 22, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 34,
+	23, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 37,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 23, 23,
+	23, 23, 23, 23, 23, 23, 8, 8,
+	27, 23, 8, 8, 29, 29, 8, 8,
+	29, 29, 12, 24, 12, 24, 12, 24,
+	12, 24, 23, 23, 23, 23, 6, 34,
+	23, 23, 8, 23, 23, 8, 8, 8,
+	8, 8, 93, 93, 51, 23, 23, 8,
+	8, 23, 12, 23, 23, 23, 23, 23,
+	23, 23, 23, 8, 23, 8, 23, 23,
+	8, 8, 8, 6, 6, 12, 13, 12,
+	13, 12, 13, 12, 13, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 8, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	65, 94, 95, 70, 70, 96, 97, 97,
+	89, 24, 89, 24, 89, 24, 89, 24,
+	89, 24, 70, 70, 89, 24, 89, 24,
+	89, 24, 89, 24, 66, 89, 24, 24,
+	70, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 37, 37, 37, 37, 37, 37,
+	88, 98, 98, 98, 98, 99, 70, 70,
+	97, 97, 97, 96, 96, 88, 70, 70,
+	8, 100, 97, 100, 97, 100, 97, 100,
+	97, 100, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 100, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 100, 97, 100, 97, 100,
+	97, 97, 97, 97, 97, 97, 100, 97,
+	97, 97, 97, 97, 97, 100, 100, 8,
+	8, 37, 37, 101, 101, 100, 100, 97,
+	101, 102, 98, 102, 98, 102, 98, 102,
+	98, 102, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 102, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 102, 98, 102, 98, 102,
+	98, 98, 98, 98, 98, 98, 102, 98,
+	98, 98, 98, 98, 98, 102, 102, 98,
+	98, 98, 98, 66, 102, 102, 102, 98,
+	8, 8, 8, 8, 8, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	8, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 70,
+	102, 102, 102, 102, 102, 102, 102, 102,
+	102, 102, 102, 102, 102, 102, 102, 102,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 88,
+	70, 88, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 70,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 96, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 8, 8, 8,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 23, 51,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 23, 6, 51,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 34, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 34, 37,
+	37, 37, 37, 8, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 8, 34,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 22, 22, 37, 37,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	37, 37, 8, 51, 23, 23, 23, 51,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	33, 33, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 20, 22, 20, 22, 20, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	34, 33, 33, 20, 22, 20, 22, 34,
+	20, 22, 20, 22, 22, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 20, 20, 20, 20, 22,
+	20, 20, 20, 20, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 20, 20, 20,
+	22, 20, 22, 20, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 22, 20, 22,
+	20, 22, 20, 22, 20, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 22, 22, 22, 22, 20, 22, 34,
+	22, 22, 22, 34, 34, 34, 34, 34,
+	34, 34, 37, 34, 34, 34, 37, 34,
+	34, 34, 34, 37, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 48, 48, 37, 37, 48,
+	8, 8, 8, 8, 37, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	10, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 31, 31, 6, 6,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	48, 48, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 51, 51,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 34, 31, 34, 34, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	37, 37, 37, 37, 37, 37, 23, 51,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 48, 37, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 8, 8, 8,
+	37, 37, 37, 48, 34, 34, 34, 34,
+	34, 49, 49, 49, 34, 34, 34, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 37, 48, 48, 37, 37,
+	37, 37, 48, 48, 37, 37, 48, 48,
+	61, 70, 70, 70, 70, 70, 70, 23,
+	51, 51, 70, 70, 70, 70, 8, 105,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 8, 8, 8, 8, 70, 70,
+	58, 58, 58, 58, 58, 54, 53, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 58, 58, 58, 58, 58, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 37, 37, 37, 37, 37, 37, 48,
+	48, 37, 37, 48, 48, 37, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	105, 105, 105, 37, 105, 105, 105, 105,
+	105, 105, 105, 105, 37, 48, 8, 8,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 8, 8, 70, 51, 51, 51,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58,
+	53, 58, 58, 58, 53, 53, 53, 8,
+	8, 8, 58, 59, 54, 59, 58, 58,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	54, 53, 54, 54, 54, 53, 53, 54,
+	54, 53, 53, 53, 53, 53, 54, 54,
+	53, 54, 53, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 53, 53, 53, 8, 8,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 48, 37, 37, 48, 48,
+	51, 51, 34, 34, 34, 48, 50, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 34, 34, 34, 34, 34, 34, 8,
+	8, 34, 34, 34, 34, 34, 34, 8,
+	8, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 33, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 8, 8, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 34, 34, 34, 34, 34,
+	34, 34, 34, 48, 48, 37, 48, 48,
+	37, 48, 48, 51, 48, 37, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 106, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	106, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 8,
+	8, 8, 8, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 8, 8, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 22, 22, 22, 22, 22,
+	8, 8, 8, 8, 8, 42, 37, 42,
+	42, 42, 42, 42, 42, 42, 42, 42,
+	42, 8, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 8,
+	42, 42, 42, 42, 42, 8, 42, 8,
+	42, 42, 8, 42, 42, 8, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 24, 12,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 10, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	94, 94, 95, 108, 109, 6, 6, 89,
+	24, 77, 8, 8, 8, 8, 8, 8,
+	38, 37, 38, 37, 38, 37, 38, 38,
+	37, 38, 37, 38, 37, 38, 38, 37,
+	70, 110, 110, 111, 111, 89, 24, 89,
+	24, 89, 24, 89, 24, 89, 24, 89,
+	24, 89, 24, 89, 24, 70, 70, 89,
+	24, 70, 70, 70, 70, 111, 111, 111,
+	112, 110, 113, 8, 114, 108, 6, 6,
+	110, 89, 24, 89, 24, 89, 24, 70,
+	70, 70, 70, 110, 70, 70, 70, 8,
+	70, 9, 10, 70, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 8, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 84,
+	8, 6, 70, 70, 9, 10, 70, 115,
+	89, 24, 70, 70, 112, 110, 113, 70,
+	116, 116, 116, 116, 116, 116, 116, 116,
+	116, 116, 108, 114, 70, 70, 70, 6,
+	70, 117, 117, 117, 117, 117, 117, 117,
+	117, 117, 117, 117, 117, 117, 117, 117,
+	117, 117, 117, 117, 117, 117, 117, 117,
+	117, 117, 117, 89, 70, 24, 70, 111,
+	70, 118, 118, 118, 118, 118, 118, 118,
+	118, 118, 118, 118, 118, 118, 118, 118,
+	118, 118, 118, 118, 118, 118, 118, 118,
+	118, 118, 118, 89, 70, 24, 70, 89,
+	24, 95, 89, 24, 94, 66, 98, 102,
+	102, 102, 102, 102, 102, 102, 102, 102,
+	102, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 119, 119,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 8,
+	8, 8, 103, 103, 103, 103, 103, 103,
+	8, 8, 103, 103, 103, 103, 103, 103,
+	8, 8, 103, 103, 103, 103, 103, 103,
+	8, 8, 103, 103, 103, 8, 8, 8,
+	10, 9, 70, 70, 70, 9, 9, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 44, 44, 44, 120, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 34, 34, 8, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 8,
+	23, 23, 23, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	37, 37, 37, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 23,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	23, 34, 34, 34, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 8, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 8, 20, 20, 20, 20,
+	20, 20, 20, 8, 20, 20, 8, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 8, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 8, 22, 22, 22, 22, 22,
+	22, 22, 8, 22, 22, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	22, 34, 34, 22, 22, 22, 8, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 8, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 34,
+	34, 8, 8, 8, 34, 8, 8, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 23,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 23,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	49, 37, 37, 37, 8, 37, 37, 8,
+	8, 8, 8, 8, 37, 37, 37, 37,
+	49, 49, 49, 49, 8, 49, 49, 49,
+	8, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 8, 8,
+	37, 37, 37, 8, 8, 8, 8, 50,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	23, 23, 23, 23, 23, 23, 51, 51,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 37, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	23, 23, 23, 23, 23, 23, 77, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	8, 23, 23, 23, 23, 23, 23, 23,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 37, 37, 37, 37,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 34, 34, 34, 34, 34,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 8, 8,
+	8, 37, 37, 37, 37, 37, 8, 34,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 37, 37, 8, 8, 8,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	23, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 37, 37, 37, 37, 37, 37,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 8, 8, 8, 8, 46, 46, 46,
+	46, 46, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 37, 37, 37, 37, 46, 46,
+	46, 46, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	48, 37, 48, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 54, 51,
+	51, 70, 70, 70, 70, 70, 8, 8,
+	8, 8, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 69, 69,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	37, 34, 34, 37, 37, 34, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 38,
+	37, 37, 48, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	48, 48, 48, 37, 37, 37, 37, 48,
+	48, 37, 37, 8, 8, 43, 51, 51,
+	51, 51, 37, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 43, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 37,
+	37, 37, 37, 37, 48, 37, 37, 37,
+	37, 37, 37, 50, 37, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	23, 51, 51, 51, 49, 48, 48, 49,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 37, 8, 31, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 48, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 48, 48, 48, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 48,
+	37, 34, 52, 52, 34, 51, 51, 8,
+	23, 37, 37, 37, 37, 46, 48, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 34, 31, 34, 23, 51, 51,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 48, 48, 48, 37,
+	37, 37, 48, 48, 37, 37, 37, 37,
+	51, 51, 8, 51, 51, 8, 37, 34,
+	34, 37, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 8, 34, 34, 34, 34, 8, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 51, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 37,
+	48, 48, 48, 37, 37, 37, 37, 37,
+	37, 37, 37, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	37, 37, 48, 48, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 34,
+	34, 8, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 8, 34, 34, 34,
+	34, 34, 8, 37, 37, 105, 37, 48,
+	37, 48, 48, 48, 48, 8, 8, 48,
+	48, 8, 8, 48, 48, 54, 8, 8,
+	34, 8, 8, 8, 8, 8, 8, 37,
+	8, 8, 8, 8, 8, 105, 34, 34,
+	34, 34, 48, 48, 8, 8, 37, 37,
+	37, 37, 37, 37, 37, 8, 8, 8,
+	37, 37, 37, 37, 37, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 8, 49, 8, 8, 49, 8,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 8, 103,
+	37, 48, 48, 37, 37, 37, 37, 37,
+	37, 8, 37, 8, 8, 37, 8, 37,
+	37, 37, 48, 8, 48, 48, 37, 37,
+	61, 52, 37, 103, 121, 121, 8, 70,
+	70, 8, 8, 8, 8, 8, 8, 8,
+	8, 37, 37, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 48, 48, 48,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	48, 48, 37, 37, 37, 48, 37, 34,
+	34, 34, 34, 51, 51, 23, 23, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 23, 23, 8, 8, 37, 34,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	37, 48, 48, 37, 37, 37, 37, 37,
+	37, 48, 37, 48, 48, 37, 48, 37,
+	37, 48, 37, 37, 34, 34, 8, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 37,
+	48, 48, 37, 37, 37, 37, 8, 8,
+	48, 48, 48, 48, 37, 37, 48, 37,
+	37, 31, 51, 51, 41, 41, 8, 8,
+	8, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51,
+	34, 34, 34, 34, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	48, 48, 48, 37, 37, 37, 37, 37,
+	37, 37, 37, 48, 48, 37, 48, 37,
+	37, 51, 51, 8, 34, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	31, 31, 31, 31, 31, 31, 31, 31,
+	31, 31, 31, 31, 31, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 37, 48, 37, 48, 48,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 8, 8, 54, 60, 54,
+	59, 59, 54, 54, 54, 54, 60, 54,
+	54, 54, 54, 54, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 51, 51, 51, 8,
+	53, 53, 53, 53, 53, 53, 53, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 48, 48, 48, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	48, 37, 37, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 34,
+	49, 49, 49, 49, 49, 49, 49, 8,
+	8, 49, 8, 8, 49, 49, 49, 49,
+	49, 49, 49, 49, 8, 49, 49, 8,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	37, 48, 48, 48, 48, 48, 8, 48,
+	48, 8, 8, 37, 37, 37, 61, 52,
+	48, 52, 48, 37, 51, 23, 51, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 48, 48, 48, 37, 37, 37, 37,
+	8, 8, 37, 37, 48, 48, 48, 48,
+	37, 34, 31, 34, 48, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	49, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 37, 37, 37, 37, 37,
+	37, 48, 34, 37, 37, 37, 37, 31,
+	8, 23, 51, 51, 23, 31, 8, 50,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	49, 37, 37, 37, 37, 37, 37, 48,
+	48, 37, 37, 37, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 52, 52, 52, 52,
+	52, 52, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 48,
+	37, 50, 23, 51, 51, 34, 31, 31,
+	31, 23, 23, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	31, 31, 31, 31, 31, 31, 31, 31,
+	31, 31, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 48, 37, 37, 37, 48, 37, 48,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 48,
+	37, 37, 37, 37, 37, 37, 37, 8,
+	37, 37, 37, 37, 37, 37, 48, 37,
+	34, 51, 51, 23, 23, 23, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	31, 41, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	8, 48, 37, 37, 37, 37, 37, 37,
+	37, 48, 37, 37, 48, 37, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 37, 37, 37, 37, 37, 37, 8,
+	8, 8, 37, 8, 37, 37, 8, 37,
+	37, 37, 37, 37, 37, 37, 52, 37,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 8, 34,
+	34, 8, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 48, 48, 48, 48, 48, 8,
+	37, 37, 8, 48, 48, 37, 48, 37,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 105, 37, 37, 48, 48, 51,
+	51, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 52, 48, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 8, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 48, 48, 37, 37,
+	37, 37, 37, 8, 8, 8, 48, 48,
+	37, 37, 61, 51, 51, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 37, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 10, 10, 10,
+	10, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 23,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	23, 23, 23, 23, 23, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	122, 122, 122, 123, 123, 123, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 123, 34, 34, 34, 122, 123,
+	122, 123, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 122, 123, 123, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 122,
+	68, 68, 68, 68, 68, 68, 68, 124,
+	125, 68, 68, 68, 124, 125, 124, 125,
+	37, 34, 34, 34, 34, 34, 34, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 122, 123,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 48, 48, 48, 37, 37, 37,
+	69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 51, 51,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	37, 37, 37, 37, 37, 51, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	37, 37, 37, 37, 37, 37, 37, 51,
+	51, 23, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 51, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 126, 34, 34, 34, 126,
+	126, 126, 126, 34, 34, 8, 51, 51,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 23,
+	51, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 8, 8, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 37,
+	34, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48,
+	8, 8, 8, 8, 8, 8, 8, 37,
+	37, 37, 37, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	96, 96, 66, 96, 38, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 100, 100, 97, 97, 97, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 53,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	127, 127, 127, 127, 8, 127, 127, 127,
+	127, 127, 127, 127, 8, 127, 127, 8,
+	98, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	98, 98, 98, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 100, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	100, 100, 100, 8, 8, 102, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 102, 102, 102, 102,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 8, 8, 37, 37, 51,
+	44, 44, 44, 44, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 37, 37, 37,
+	37, 37, 8, 8, 8, 37, 37, 37,
+	37, 37, 37, 44, 44, 44, 44, 44,
+	44, 44, 44, 37, 37, 37, 37, 37,
+	37, 37, 37, 8, 8, 37, 37, 37,
+	37, 37, 37, 37, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 37, 37, 37, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 37, 37, 37, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 22, 22,
+	22, 22, 22, 22, 22, 8, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 20, 8, 20, 20,
+	8, 8, 20, 8, 8, 20, 20, 8,
+	8, 20, 20, 20, 20, 8, 20, 20,
+	20, 20, 20, 20, 20, 20, 22, 22,
+	22, 22, 8, 22, 8, 22, 22, 22,
+	22, 22, 22, 22, 8, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 20, 20, 8, 20,
+	20, 20, 20, 8, 8, 20, 20, 20,
+	20, 20, 20, 20, 20, 8, 20, 20,
+	20, 20, 20, 20, 20, 8, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 8, 20, 20, 20, 20, 8,
+	20, 20, 20, 20, 20, 8, 20, 8,
+	8, 8, 20, 20, 20, 20, 20, 20,
+	20, 8, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 8, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 8, 22, 22, 22, 22,
+	22, 22, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 8, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 8, 22, 22,
+	22, 22, 22, 22, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 8, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 8,
+	22, 22, 22, 22, 22, 22, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 8, 22, 22, 22, 22, 22, 22,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 8, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 8, 22, 22, 22, 22,
+	22, 22, 20, 22, 8, 8, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 8,
+	8, 8, 8, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 8, 8, 8,
+	8, 8, 8, 8, 8, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 37, 8, 8, 23,
+	51, 23, 23, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 37, 37, 37, 37, 37,
+	8, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 34, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 8,
+	8, 8, 8, 8, 8, 22, 22, 22,
+	22, 22, 22, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 8,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 8, 8, 37, 37, 37, 37, 37,
+	37, 37, 8, 37, 37, 8, 37, 37,
+	37, 37, 37, 8, 8, 8, 8, 8,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 37,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 34,
+	34, 34, 34, 34, 34, 34, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 34, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 37, 37, 37, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 9,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 37, 37, 37, 37,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	34, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 37, 34, 34, 37, 34,
+	34, 34, 34, 34, 34, 34, 37, 37,
+	34, 34, 34, 34, 34, 37, 8, 8,
+	8, 8, 8, 8, 8, 8, 34, 34,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 8, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	37, 37, 37, 37, 37, 37, 37, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 37, 37, 37, 37,
+	37, 37, 37, 34, 8, 8, 8, 8,
+	18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 8, 8, 8, 8, 27, 27,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 10, 8, 8, 8,
+	10, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	34, 34, 34, 34, 8, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	8, 34, 34, 8, 34, 8, 8, 34,
+	8, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 8, 34, 34, 34, 34,
+	8, 34, 8, 34, 8, 8, 8, 8,
+	8, 8, 34, 8, 8, 8, 8, 34,
+	8, 34, 8, 34, 8, 34, 34, 34,
+	8, 34, 34, 8, 34, 8, 8, 34,
+	8, 34, 8, 34, 8, 34, 8, 34,
+	8, 34, 34, 8, 34, 8, 8, 34,
+	34, 34, 34, 8, 34, 34, 34, 34,
+	34, 34, 34, 8, 34, 34, 34, 34,
+	8, 34, 34, 34, 34, 8, 34, 8,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	8, 34, 34, 34, 8, 34, 34, 34,
+	34, 34, 8, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 34, 34, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	70, 70, 70, 70, 88, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 128, 128, 128, 128,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 128,
+	128, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	128, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 88,
+	128, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 8, 8, 8, 8, 8, 8,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 8, 8, 8, 8, 8, 8,
+	90, 90, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 90, 90,
+	20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 8, 8, 8, 8, 28, 8,
+	8, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 129, 129,
+	129, 129, 129, 129, 129, 129, 129, 129,
+	129, 129, 129, 129, 129, 129, 129, 129,
+	129, 129, 129, 129, 129, 129, 129, 129,
+	70, 88, 88, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 88, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 88,
+	70, 70, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 70, 128, 128, 128, 128,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 128, 128, 128, 128, 128, 128, 128,
+	88, 88, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	70, 70, 70, 70, 70, 70, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 70, 70, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 91, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 70, 70, 88, 88,
+	70, 88, 88, 88, 8, 8, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 28, 28, 88,
+	88, 88, 88, 88, 28, 88, 88, 88,
+	88, 88, 91, 91, 91, 88, 88, 91,
+	88, 88, 91, 91, 91, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 70, 70, 88, 88, 88, 70, 88,
+	88, 88, 88, 130, 130, 130, 130, 130,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 91, 91, 88, 88, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91,
+	91, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91,
+	91, 88, 88, 88, 91, 88, 88, 88,
+	88, 91, 91, 91, 88, 91, 91, 91,
+	88, 88, 88, 88, 88, 88, 88, 91,
+	88, 91, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	28, 88, 28, 88, 28, 88, 88, 88,
+	88, 88, 91, 88, 88, 88, 88, 28,
+	88, 28, 28, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 70, 88,
+	28, 28, 28, 28, 28, 28, 28, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 28,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 28, 88, 88, 88, 88, 88, 70,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	70, 70, 70, 70, 70, 70, 70, 88,
+	88, 70, 70, 88, 91, 91, 88, 88,
+	88, 88, 91, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 88,
+	70, 70, 88, 88, 88, 88, 70, 70,
+	91, 70, 70, 70, 70, 91, 91, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 88, 88, 70, 70,
+	88, 70, 70, 70, 70, 70, 70, 70,
+	70, 88, 88, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 88, 70, 70, 70,
+	70, 70, 88, 88, 88, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 88, 88, 88, 8, 8, 8, 8,
+	8, 8, 8, 8, 88, 88, 88, 70,
+	70, 88, 70, 88, 70, 70, 70, 70,
+	88, 70, 70, 70, 70, 70, 70, 88,
+	70, 70, 70, 88, 8, 8, 8, 8,
+	8, 8, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 91, 91, 91,
+	88, 88, 88, 91, 91, 91, 91, 91,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 29, 29,
+	29, 66, 66, 66, 8, 8, 8, 8,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 91, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 91, 91, 91, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	91, 88, 88, 88, 88, 88, 70, 70,
+	70, 70, 70, 88, 91, 88, 88, 88,
+	88, 88, 88, 70, 70, 88, 88, 88,
+	88, 128, 128, 128, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 70, 70,
+	70, 88, 70, 88, 88, 128, 128, 128,
+	88, 70, 70, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 128, 128, 128,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 70, 70, 70, 8,
+	8, 8, 8, 70, 70, 70, 70, 70,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 70, 70, 70,
+	70, 70, 128, 128, 128, 128, 128, 128,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 128, 128, 128, 128,
+	88, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 28, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 28, 28, 28, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 28, 28, 28, 28,
+	8, 8, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 91, 88, 88, 91,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	91, 91, 91, 91, 91, 91, 91, 91,
+	88, 88, 88, 88, 88, 88, 91, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 88, 70, 91, 91, 91, 88,
+	88, 88, 88, 88, 88, 88, 70, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 91,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 91, 91, 88,
+	91, 91, 88, 91, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 91, 91, 91,
+	88, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 128, 128,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 128, 128, 128,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 128, 128, 128, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 91, 91, 91, 88, 128,
+	88, 128, 128, 128, 128, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 128, 128, 88,
+	88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 128, 128, 128, 128, 88,
+	91, 91, 91, 91, 91, 91, 91, 91,
+	91, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 8, 8, 8, 8, 8,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	86, 44, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86
+};
@@ -0,0 +1,3592 @@
+/* Automatically generated by gen/sentence-test */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../gen/types.h"
+
+static const struct break_test sentence_break_test[] = {
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000085), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NEXT LINE (NEL)> (Sep) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000009), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CHARACTER TABULATION> (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0001BB), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN LETTER TWO WITH STROKE (OLetter) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [9.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [9.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [9.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [8.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) ÷ [11.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) ÷ [11.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [6.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [6.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [8.1] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.1] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [8.1] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.1] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [9.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [8.1] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.1] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) ÷ [11.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (ATerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [9.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [9.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [9.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) ÷ [11.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) ÷ [11.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) ÷ [11.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) ÷ [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [8.1] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.1] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [8.1] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.1] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [9.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [9.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [8.1] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) × [8.1] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) ÷ [11.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (SContinue) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000085) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000085) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NEXT LINE (NEL)> (Sep) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000009) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000009) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <CHARACTER TABULATION> (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000061) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000061) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0001BB) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0001BB) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN LETTER TWO WITH STROKE (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000021) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000021) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] EXCLAMATION MARK (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] QUOTATION MARK (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] COMMA (SContinue) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XX) × [5.0] COMBINING DIAERESIS (Extend) × [998.0] <NULL> (XX) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x00000A), UINT32_C(0x000308) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN SMALL LETTER A (Lower) × [998.0] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [5.0] COMBINING DIAERESIS (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00200D), UINT32_C(0x000646) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (Sp) × [5.0] ZERO WIDTH JOINER (Extend) × [998.0] ARABIC LETTER NOON (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000646), UINT32_C(0x00200D), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ARABIC LETTER NOON (OLetter) × [5.0] ZERO WIDTH JOINER (Extend) × [998.0] SPACE (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000028), UINT32_C(0x000022), UINT32_C(0x000047), UINT32_C(0x00006F), UINT32_C(0x00002E), UINT32_C(0x000022), UINT32_C(0x000029), UINT32_C(0x000020), UINT32_C(0x000028), UINT32_C(0x000048), UINT32_C(0x000065), UINT32_C(0x000020), UINT32_C(0x000064), UINT32_C(0x000069), UINT32_C(0x000064), UINT32_C(0x00002E), UINT32_C(0x000029) },
+		.cplen  = 17,
+		.len    = (size_t[]){ 8, 9 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LEFT PARENTHESIS (Close) × [998.0] QUOTATION MARK (Close) × [998.0] LATIN CAPITAL LETTER G (Upper) × [998.0] LATIN SMALL LETTER O (Lower) × [998.0] FULL STOP (ATerm) × [9.0] QUOTATION MARK (Close) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] SPACE (Sp) ÷ [11.0] LEFT PARENTHESIS (Close) × [998.0] LATIN CAPITAL LETTER H (Upper) × [998.0] LATIN SMALL LETTER E (Lower) × [998.0] SPACE (Sp) × [998.0] LATIN SMALL LETTER D (Lower) × [998.0] LATIN SMALL LETTER I (Lower) × [998.0] LATIN SMALL LETTER D (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000028), UINT32_C(0x00201C), UINT32_C(0x000047), UINT32_C(0x00006F), UINT32_C(0x00003F), UINT32_C(0x00201D), UINT32_C(0x000029), UINT32_C(0x000020), UINT32_C(0x000028), UINT32_C(0x000048), UINT32_C(0x000065), UINT32_C(0x000020), UINT32_C(0x000064), UINT32_C(0x000069), UINT32_C(0x000064), UINT32_C(0x00002E), UINT32_C(0x000029) },
+		.cplen  = 17,
+		.len    = (size_t[]){ 8, 9 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LEFT PARENTHESIS (Close) × [998.0] LEFT DOUBLE QUOTATION MARK (Close) × [998.0] LATIN CAPITAL LETTER G (Upper) × [998.0] LATIN SMALL LETTER O (Lower) × [998.0] QUESTION MARK (STerm) × [9.0] RIGHT DOUBLE QUOTATION MARK (Close) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] SPACE (Sp) ÷ [11.0] LEFT PARENTHESIS (Close) × [998.0] LATIN CAPITAL LETTER H (Upper) × [998.0] LATIN SMALL LETTER E (Lower) × [998.0] SPACE (Sp) × [998.0] LATIN SMALL LETTER D (Lower) × [998.0] LATIN SMALL LETTER I (Lower) × [998.0] LATIN SMALL LETTER D (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000055), UINT32_C(0x00002E), UINT32_C(0x000053), UINT32_C(0x00002E), UINT32_C(0x000041), UINT32_C(0x000300), UINT32_C(0x00002E), UINT32_C(0x000020), UINT32_C(0x000069), UINT32_C(0x000073) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 10 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER U (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER S (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING GRAVE ACCENT (Extend) × [998.0] FULL STOP (ATerm) × [8.0] SPACE (Sp) × [8.0] LATIN SMALL LETTER I (Lower) × [998.0] LATIN SMALL LETTER S (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000055), UINT32_C(0x00002E), UINT32_C(0x000053), UINT32_C(0x00002E), UINT32_C(0x000041), UINT32_C(0x000300), UINT32_C(0x00003F), UINT32_C(0x000020), UINT32_C(0x000048), UINT32_C(0x000065) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 8, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER U (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER S (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING GRAVE ACCENT (Extend) × [998.0] QUESTION MARK (STerm) × [9.0] SPACE (Sp) ÷ [11.0] LATIN CAPITAL LETTER H (Upper) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000055), UINT32_C(0x00002E), UINT32_C(0x000053), UINT32_C(0x00002E), UINT32_C(0x000041), UINT32_C(0x000300), UINT32_C(0x00002E) },
+		.cplen  = 7,
+		.len    = (size_t[]){ 7 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER U (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER S (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER A (Upper) × [5.0] COMBINING GRAVE ACCENT (Extend) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000033), UINT32_C(0x00002E), UINT32_C(0x000034) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT THREE (Numeric) × [998.0] FULL STOP (ATerm) × [6.0] DIGIT FOUR (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000064) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [8.0] LATIN SMALL LETTER D (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000043), UINT32_C(0x00002E), UINT32_C(0x000064) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER C (Upper) × [998.0] FULL STOP (ATerm) × [8.0] LATIN SMALL LETTER D (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000044) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER D (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000043), UINT32_C(0x00002E), UINT32_C(0x000044) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER C (Upper) × [998.0] FULL STOP (ATerm) × [7.0] LATIN CAPITAL LETTER D (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x0000A0), UINT32_C(0x000074), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 10 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [8.0] RIGHT PARENTHESIS (Close) × [8.0] RIGHT SINGLE QUOTATION MARK (Close) × [8.0] NO-BREAK SPACE (Sp) × [8.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x0000A0), UINT32_C(0x000054), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 7, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [9.0] NO-BREAK SPACE (Sp) ÷ [11.0] LATIN CAPITAL LETTER T (Upper) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x0000A0), UINT32_C(0x002018), UINT32_C(0x000028), UINT32_C(0x000074), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 12,
+		.len    = (size_t[]){ 12 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [8.0] RIGHT PARENTHESIS (Close) × [8.0] RIGHT SINGLE QUOTATION MARK (Close) × [8.0] NO-BREAK SPACE (Sp) × [8.0] LEFT SINGLE QUOTATION MARK (Close) × [998.0] LEFT PARENTHESIS (Close) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x0000A0), UINT32_C(0x002018), UINT32_C(0x000028), UINT32_C(0x000054), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 12,
+		.len    = (size_t[]){ 7, 5 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [9.0] NO-BREAK SPACE (Sp) ÷ [11.0] LEFT SINGLE QUOTATION MARK (Close) × [998.0] LEFT PARENTHESIS (Close) × [998.0] LATIN CAPITAL LETTER T (Upper) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x0000A0), UINT32_C(0x000308), UINT32_C(0x000074), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 11,
+		.len    = (size_t[]){ 11 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [8.0] RIGHT PARENTHESIS (Close) × [8.0] RIGHT SINGLE QUOTATION MARK (Close) × [8.0] NO-BREAK SPACE (Sp) × [5.0] COMBINING DIAERESIS (Extend) × [8.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x0000A0), UINT32_C(0x000308), UINT32_C(0x000054), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 11,
+		.len    = (size_t[]){ 8, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [9.0] NO-BREAK SPACE (Sp) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN CAPITAL LETTER T (Upper) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x002019), UINT32_C(0x000308), UINT32_C(0x000054), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 7, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN CAPITAL LETTER T (Upper) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x000029), UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000054), UINT32_C(0x000068), UINT32_C(0x000065) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 6, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [9.0] RIGHT PARENTHESIS (Close) × [9.0] <LINE FEED (LF)> (LF) ÷ [4.0] COMBINING DIAERESIS (Extend) × [998.0] LATIN CAPITAL LETTER T (Upper) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000074), UINT32_C(0x000068), UINT32_C(0x000065), UINT32_C(0x000020), UINT32_C(0x000072), UINT32_C(0x000065), UINT32_C(0x000073), UINT32_C(0x000070), UINT32_C(0x00002E), UINT32_C(0x000020), UINT32_C(0x00006C), UINT32_C(0x000065), UINT32_C(0x000061), UINT32_C(0x000064), UINT32_C(0x000065), UINT32_C(0x000072), UINT32_C(0x000073), UINT32_C(0x000020), UINT32_C(0x000061), UINT32_C(0x000072), UINT32_C(0x000065) },
+		.cplen  = 21,
+		.len    = (size_t[]){ 21 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER H (Lower) × [998.0] LATIN SMALL LETTER E (Lower) × [998.0] SPACE (Sp) × [998.0] LATIN SMALL LETTER R (Lower) × [998.0] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER S (Lower) × [998.0] LATIN SMALL LETTER P (Lower) × [998.0] FULL STOP (ATerm) × [8.0] SPACE (Sp) × [8.0] LATIN SMALL LETTER L (Lower) × [998.0] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER A (Lower) × [998.0] LATIN SMALL LETTER D (Lower) × [998.0] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER R (Lower) × [998.0] LATIN SMALL LETTER S (Lower) × [998.0] SPACE (Sp) × [998.0] LATIN SMALL LETTER A (Lower) × [998.0] LATIN SMALL LETTER R (Lower) × [998.0] LATIN SMALL LETTER E (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x005B57), UINT32_C(0x00002E), UINT32_C(0x005B57) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CJK UNIFIED IDEOGRAPH-5B57 (OLetter) × [998.0] FULL STOP (ATerm) ÷ [11.0] CJK UNIFIED IDEOGRAPH-5B57 (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x005B83) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) ÷ [11.0] CJK UNIFIED IDEOGRAPH-5B83 (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000065), UINT32_C(0x000074), UINT32_C(0x000063), UINT32_C(0x00002E), UINT32_C(0x003002) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER E (Lower) × [998.0] LATIN SMALL LETTER T (Lower) × [998.0] LATIN SMALL LETTER C (Lower) × [998.0] FULL STOP (ATerm) × [8.1] IDEOGRAPHIC FULL STOP (STerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x005B57), UINT32_C(0x003002), UINT32_C(0x005B83) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CJK UNIFIED IDEOGRAPH-5B57 (OLetter) × [998.0] IDEOGRAPHIC FULL STOP (STerm) ÷ [11.0] CJK UNIFIED IDEOGRAPH-5B83 (OLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000021), UINT32_C(0x000020), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] EXCLAMATION MARK (STerm) × [9.0] SPACE (Sp) × [10.0] SPACE (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] FULL STOP (ATerm) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00000D), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] FULL STOP (ATerm) × [9.0] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00000D), UINT32_C(0x00000A), UINT32_C(0x000020) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] FULL STOP (ATerm) × [9.0] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [4.0] SPACE (Sp) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00000D), UINT32_C(0x00000A), UINT32_C(0x000061) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (Lower) × [998.0] FULL STOP (ATerm) × [9.0] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN SMALL LETTER A (Lower) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00002E), UINT32_C(0x00000D), UINT32_C(0x00000A), UINT32_C(0x000041) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (Upper) × [998.0] FULL STOP (ATerm) × [9.0] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN CAPITAL LETTER A (Upper) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000028), UINT32_C(0x002060), UINT32_C(0x000022), UINT32_C(0x002060), UINT32_C(0x000047), UINT32_C(0x002060), UINT32_C(0x00006F), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000022), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000028), UINT32_C(0x002060), UINT32_C(0x000048), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x000069), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 36,
+		.len    = (size_t[]){ 17, 19 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LEFT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [998.0] QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER G (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER O (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] SPACE (Sp) × [5.0] WORD JOINER (Format) ÷ [11.0] LEFT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER H (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER I (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000028), UINT32_C(0x002060), UINT32_C(0x00201C), UINT32_C(0x002060), UINT32_C(0x000047), UINT32_C(0x002060), UINT32_C(0x00006F), UINT32_C(0x002060), UINT32_C(0x00003F), UINT32_C(0x002060), UINT32_C(0x00201D), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000028), UINT32_C(0x002060), UINT32_C(0x000048), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x000069), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 36,
+		.len    = (size_t[]){ 17, 19 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LEFT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [998.0] LEFT DOUBLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER G (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER O (Lower) × [5.0] WORD JOINER (Format) × [998.0] QUESTION MARK (STerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT DOUBLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] SPACE (Sp) × [5.0] WORD JOINER (Format) ÷ [11.0] LEFT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER H (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER I (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000055), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000053), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000041), UINT32_C(0x002060), UINT32_C(0x000300), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000069), UINT32_C(0x002060), UINT32_C(0x000073), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 21,
+		.len    = (size_t[]){ 21 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER U (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER S (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER A (Upper) × [5.0] WORD JOINER (Format) × [5.0] COMBINING GRAVE ACCENT (Extend) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [8.0] LATIN SMALL LETTER I (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER S (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000055), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000053), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000041), UINT32_C(0x002060), UINT32_C(0x000300), UINT32_C(0x00003F), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000048), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 21,
+		.len    = (size_t[]){ 16, 5 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER U (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER S (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER A (Upper) × [5.0] WORD JOINER (Format) × [5.0] COMBINING GRAVE ACCENT (Extend) × [998.0] QUESTION MARK (STerm) × [5.0] WORD JOINER (Format) × [9.0] SPACE (Sp) × [5.0] WORD JOINER (Format) ÷ [11.0] LATIN CAPITAL LETTER H (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000055), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000053), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000041), UINT32_C(0x002060), UINT32_C(0x000300), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 15,
+		.len    = (size_t[]){ 15 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER U (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER S (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER A (Upper) × [5.0] WORD JOINER (Format) × [5.0] COMBINING GRAVE ACCENT (Extend) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000033), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000034), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 8 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] DIGIT THREE (Numeric) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [6.0] DIGIT FOUR (Numeric) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 8 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000043), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 8 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER C (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000044), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 8 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER D (Upper) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000043), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000044), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 8 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER C (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER D (Upper) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x0000A0), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 22,
+		.len    = (size_t[]){ 22 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [8.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [8.0] NO-BREAK SPACE (Sp) × [5.0] WORD JOINER (Format) × [8.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x0000A0), UINT32_C(0x002060), UINT32_C(0x000054), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 22,
+		.len    = (size_t[]){ 15, 7 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [9.0] NO-BREAK SPACE (Sp) × [5.0] WORD JOINER (Format) ÷ [11.0] LATIN CAPITAL LETTER T (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x0000A0), UINT32_C(0x002060), UINT32_C(0x002018), UINT32_C(0x002060), UINT32_C(0x000028), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 26,
+		.len    = (size_t[]){ 26 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [8.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [8.0] NO-BREAK SPACE (Sp) × [5.0] WORD JOINER (Format) × [8.0] LEFT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [998.0] LEFT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x0000A0), UINT32_C(0x002060), UINT32_C(0x002018), UINT32_C(0x002060), UINT32_C(0x000028), UINT32_C(0x002060), UINT32_C(0x000054), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 26,
+		.len    = (size_t[]){ 15, 11 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [9.0] NO-BREAK SPACE (Sp) × [5.0] WORD JOINER (Format) ÷ [11.0] LEFT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [998.0] LEFT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER T (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x0000A0), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 23,
+		.len    = (size_t[]){ 23 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [8.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [8.0] NO-BREAK SPACE (Sp) × [5.0] WORD JOINER (Format) × [5.0] COMBINING DIAERESIS (Extend) × [8.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x0000A0), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000054), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 23,
+		.len    = (size_t[]){ 16, 7 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [9.0] NO-BREAK SPACE (Sp) × [5.0] WORD JOINER (Format) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN CAPITAL LETTER T (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x002019), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000054), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 21,
+		.len    = (size_t[]){ 14, 7 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] RIGHT SINGLE QUOTATION MARK (Close) × [5.0] WORD JOINER (Format) × [5.0] COMBINING DIAERESIS (Extend) ÷ [11.0] LATIN CAPITAL LETTER T (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000029), UINT32_C(0x002060), UINT32_C(0x00000A), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x002060), UINT32_C(0x000054), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 22,
+		.len    = (size_t[]){ 12, 10 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] RIGHT PARENTHESIS (Close) × [5.0] WORD JOINER (Format) × [9.0] <LINE FEED (LF)> (LF) ÷ [4.0] WORD JOINER (Format) × [5.0] COMBINING DIAERESIS (Extend) × [5.0] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER T (Upper) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000068), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000072), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000073), UINT32_C(0x002060), UINT32_C(0x000070), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x00006C), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000064), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000072), UINT32_C(0x002060), UINT32_C(0x000073), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000072), UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 44,
+		.len    = (size_t[]){ 44 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER H (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER R (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER S (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER P (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [8.0] LATIN SMALL LETTER L (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER D (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER R (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER S (Lower) × [5.0] WORD JOINER (Format) × [998.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER R (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x005B57), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x005B57), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 5, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] CJK UNIFIED IDEOGRAPH-5B57 (OLetter) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) ÷ [11.0] CJK UNIFIED IDEOGRAPH-5B57 (OLetter) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x005B83), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 12,
+		.len    = (size_t[]){ 9, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) ÷ [11.0] CJK UNIFIED IDEOGRAPH-5B83 (OLetter) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000065), UINT32_C(0x002060), UINT32_C(0x000074), UINT32_C(0x002060), UINT32_C(0x000063), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x003002), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 12,
+		.len    = (size_t[]){ 12 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER E (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER T (Lower) × [5.0] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER C (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [8.1] IDEOGRAPHIC FULL STOP (STerm) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x005B57), UINT32_C(0x002060), UINT32_C(0x003002), UINT32_C(0x002060), UINT32_C(0x005B83), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 5, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] CJK UNIFIED IDEOGRAPH-5B57 (OLetter) × [5.0] WORD JOINER (Format) × [998.0] IDEOGRAPHIC FULL STOP (STerm) × [5.0] WORD JOINER (Format) ÷ [11.0] CJK UNIFIED IDEOGRAPH-5B83 (OLetter) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000021), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 8,
+		.len    = (size_t[]){ 8 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] EXCLAMATION MARK (STerm) × [5.0] WORD JOINER (Format) × [9.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [10.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000D), UINT32_C(0x002060), UINT32_C(0x00000A), UINT32_C(0x002060) },
+		.cplen  = 9,
+		.len    = (size_t[]){ 6, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] WORD JOINER (Format) × [998.0] <LINE FEED (LF)> (LF) ÷ [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000D), UINT32_C(0x002060), UINT32_C(0x00000A), UINT32_C(0x000020), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 11,
+		.len    = (size_t[]){ 6, 2, 3 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] WORD JOINER (Format) × [998.0] <LINE FEED (LF)> (LF) ÷ [4.0] SPACE (Sp) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000D), UINT32_C(0x002060), UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 11,
+		.len    = (size_t[]){ 6, 2, 3 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] WORD JOINER (Format) × [998.0] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN SMALL LETTER A (Lower) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002060), UINT32_C(0x000041), UINT32_C(0x002060), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000D), UINT32_C(0x002060), UINT32_C(0x00000A), UINT32_C(0x000041), UINT32_C(0x002060), UINT32_C(0x002060) },
+		.cplen  = 11,
+		.len    = (size_t[]){ 6, 2, 3 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] WORD JOINER (Format) × [998.0] LATIN CAPITAL LETTER A (Upper) × [5.0] WORD JOINER (Format) × [998.0] FULL STOP (ATerm) × [5.0] WORD JOINER (Format) × [9.0] <CARRIAGE RETURN (CR)> (CR) ÷ [4.0] WORD JOINER (Format) × [998.0] <LINE FEED (LF)> (LF) ÷ [4.0] LATIN CAPITAL LETTER A (Upper) × [5.0] WORD JOINER (Format) × [5.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+};
@@ -0,0 +1,4859 @@
+/* Automatically generated by gen/sentence */
+#include <stdint.h>
+
+enum sentence_break_property {
+	SENTENCE_BREAK_PROP_OTHER,
+	SENTENCE_BREAK_PROP_CR,
+	SENTENCE_BREAK_PROP_LF,
+	SENTENCE_BREAK_PROP_EXTEND,
+	SENTENCE_BREAK_PROP_SEP,
+	SENTENCE_BREAK_PROP_FORMAT,
+	SENTENCE_BREAK_PROP_SP,
+	SENTENCE_BREAK_PROP_LOWER,
+	SENTENCE_BREAK_PROP_UPPER,
+	SENTENCE_BREAK_PROP_OLETTER,
+	SENTENCE_BREAK_PROP_NUMERIC,
+	SENTENCE_BREAK_PROP_ATERM,
+	SENTENCE_BREAK_PROP_SCONTINUE,
+	SENTENCE_BREAK_PROP_STERM,
+	SENTENCE_BREAK_PROP_CLOSE,
+	NUM_SENTENCE_BREAK_PROPS,
+};
+
+static const uint_least16_t sentence_break_major[] = {
+	0, 256, 512, 768, 1024, 1280, 1536, 1792,
+	2048, 2304, 2560, 2816, 3072, 3328, 3584, 3840,
+	4096, 4352, 4608, 4864, 5120, 4349, 5376, 5632,
+	5888, 6144, 6400, 6656, 6912, 7168, 7424, 7680,
+	7936, 8192, 8448, 8704, 8960, 8329, 8329, 9216,
+	8329, 9472, 8329, 8329, 9728, 9984, 10240, 8329,
+	10496, 10752, 8329, 8329, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 11008, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 11264, 4349, 11520, 11776,
+	12032, 12288, 12544, 12800, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 13056,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 4349, 13312, 13568, 4349, 13824, 14080, 14336,
+	14592, 14848, 15104, 15360, 15616, 15872, 4349, 16128,
+	16384, 16640, 16896, 17152, 17408, 17664, 17920, 18176,
+	18432, 18688, 18944, 19200, 19456, 19712, 19968, 20224,
+	20480, 20736, 20992, 21248, 21504, 21760, 22016, 22272,
+	4349, 4349, 4349, 22528, 22784, 23040, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 23296,
+	4349, 4349, 4349, 4349, 23552, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 23808, 4349, 4349, 23037, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 24064, 8329, 8329, 8329, 8329, 8329, 8329,
+	4349, 4349, 24320, 24576, 8329, 24832, 25088, 25344,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 25600, 25856, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 26112,
+	4349, 26368, 23807, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 26624, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 26880, 8329, 8329, 27136,
+	8329, 27392, 27648, 8329, 27904, 28160, 28416, 28672,
+	8329, 8329, 28928, 8329, 8329, 8329, 8329, 29184,
+	29440, 29696, 29952, 8329, 30208, 30464, 30720, 30976,
+	31232, 31488, 8329, 8329, 8329, 8329, 31744, 8329,
+	8329, 32000, 8329, 8329, 8329, 8329, 32256, 8329,
+	8329, 8329, 8329, 26880, 8329, 8329, 8329, 8329,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 32512, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	32768, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 33024, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 33280, 4349, 4349, 23014, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	4349, 4349, 23078, 8329, 8329, 8329, 8329, 8329,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 33536, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 4349, 4349, 4349, 4349,
+	4349, 4349, 4349, 4349, 22986, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	33792, 34048, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329,
+	8329, 8329, 8329, 8329, 8329, 8329, 8329, 8329
+};
+
+static const uint_least8_t sentence_break_minor[] = {
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 2, 6, 6, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 13, 14, 0, 0, 0, 0, 14,
+	14, 14, 0, 0, 12, 12, 11, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 12, 12, 0, 0, 0, 13,
+	0, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 14, 0, 14, 0, 0,
+	0, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 14, 0, 14, 0, 0,
+	0, 0, 0, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7, 14, 0, 5, 0, 0,
+	0, 0, 0, 0, 0, 7, 0, 0,
+	0, 0, 7, 14, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 0,
+	8, 8, 8, 8, 8, 8, 8, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 8, 7, 8, 7, 8, 7, 8,
+	7, 8, 7, 8, 7, 8, 7, 8,
+	7, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 8, 7, 8, 7, 8, 7, 7,
+	7, 8, 8, 7, 8, 7, 8, 8,
+	7, 8, 8, 8, 7, 7, 8, 8,
+	8, 8, 7, 8, 8, 7, 8, 8,
+	8, 7, 7, 7, 8, 8, 7, 8,
+	8, 7, 8, 7, 8, 7, 8, 8,
+	7, 8, 7, 7, 8, 7, 8, 8,
+	7, 8, 8, 8, 7, 8, 7, 8,
+	8, 7, 7, 9, 8, 7, 7, 7,
+	9, 9, 9, 9, 8, 8, 7, 8,
+	8, 7, 8, 8, 7, 8, 7, 8,
+	7, 8, 7, 8, 7, 8, 7, 8,
+	7, 8, 7, 8, 7, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 8, 8, 7, 8, 7, 8, 8,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 7, 7, 7, 7,
+	7, 7, 8, 8, 7, 8, 8, 7,
+	7, 8, 7, 8, 8, 8, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 9, 9, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 9, 9, 9, 9, 9, 9, 9,
+	7, 7, 0, 0, 0, 0, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 0, 0, 0,
+	0, 0, 0, 0, 9, 0, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	8, 7, 8, 7, 9, 0, 8, 7,
+	0, 0, 7, 7, 7, 7, 12, 8,
+	0, 0, 0, 0, 0, 0, 8, 0,
+	8, 8, 8, 0, 8, 0, 8, 8,
+	7, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 0, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 8,
+	7, 7, 8, 8, 8, 7, 7, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 7, 7, 7, 8, 7, 0, 8,
+	7, 8, 8, 7, 7, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 0, 3, 3, 3, 3, 3,
+	3, 3, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 8, 7, 8, 7, 8, 7, 8,
+	7, 8, 7, 8, 7, 8, 7, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	0, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 0,
+	0, 9, 0, 0, 0, 12, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 13, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	0, 3, 3, 0, 3, 3, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 0, 0,
+	0, 0, 0, 0, 12, 12, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 5, 13, 13, 13,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 10, 10, 0, 9, 9,
+	3, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 13, 9, 3, 3,
+	3, 3, 3, 3, 3, 10, 0, 3,
+	3, 3, 3, 3, 3, 9, 9, 3,
+	3, 0, 3, 3, 3, 3, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 0, 0, 9,
+	13, 13, 13, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5,
+	9, 3, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 9, 9, 0, 0,
+	12, 13, 9, 0, 0, 3, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 9, 3, 3, 3,
+	9, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 13,
+	0, 13, 0, 0, 0, 13, 13, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 3, 3, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	10, 10, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 10, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 13, 13, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 9,
+	9, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 0, 0, 0, 9, 9,
+	9, 9, 0, 0, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 3,
+	3, 0, 0, 3, 3, 3, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 9, 9, 0, 9,
+	9, 9, 3, 3, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 9, 0, 3, 0,
+	0, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 9,
+	9, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 0, 9, 9, 0,
+	9, 9, 0, 0, 3, 0, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 3,
+	3, 0, 0, 3, 3, 3, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0,
+	0, 9, 9, 9, 9, 0, 9, 0,
+	0, 0, 0, 0, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	3, 3, 9, 9, 9, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 9,
+	9, 9, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 0, 9, 9, 9,
+	9, 9, 0, 0, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	3, 3, 0, 3, 3, 3, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 3, 3, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 3, 3, 3, 3, 3, 3,
+	0, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 9,
+	9, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 0, 9, 9, 9,
+	9, 9, 0, 0, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 3,
+	3, 0, 0, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 3,
+	0, 0, 0, 0, 9, 9, 0, 9,
+	9, 9, 3, 3, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 9, 0, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 9, 9,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	0, 9, 9, 0, 9, 0, 9, 9,
+	0, 0, 0, 9, 9, 0, 0, 0,
+	9, 9, 9, 0, 0, 0, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 3, 3,
+	3, 3, 3, 0, 0, 0, 3, 3,
+	3, 0, 3, 3, 3, 3, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 0, 3, 3,
+	3, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	9, 9, 9, 0, 9, 9, 0, 0,
+	9, 9, 3, 3, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 9, 9, 9,
+	9, 9, 0, 0, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 0, 3, 3,
+	3, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 0,
+	0, 0, 0, 0, 9, 9, 9, 0,
+	9, 9, 3, 3, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 9, 9, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 0, 3, 3,
+	3, 0, 3, 3, 3, 3, 9, 0,
+	0, 0, 0, 0, 9, 9, 9, 3,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	9, 9, 3, 3, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	0, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 3, 0, 0, 0, 0, 3,
+	3, 3, 3, 3, 3, 0, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 9, 0, 9, 0, 9, 9,
+	9, 9, 9, 0, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 9, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 9, 0, 0,
+	9, 9, 9, 9, 9, 0, 9, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 3,
+	0, 3, 14, 14, 14, 14, 3, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 3, 3,
+	9, 9, 9, 9, 9, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 13, 13, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 9, 9, 9, 9, 3, 3,
+	3, 9, 3, 3, 3, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 9, 9,
+	9, 3, 3, 3, 3, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 9, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 3, 3, 3, 3, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 0, 8,
+	0, 0, 0, 0, 0, 8, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 7, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 3, 3, 3,
+	0, 0, 13, 0, 0, 0, 0, 13,
+	13, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 0, 0,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 13, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	6, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 14, 14, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 13, 13, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 9, 9,
+	9, 0, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 13, 13, 0, 9,
+	0, 0, 0, 0, 9, 3, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 12, 13, 0, 0, 0, 0,
+	12, 13, 0, 3, 3, 3, 5, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 3, 3, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 9, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 13, 13, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	13, 13, 13, 13, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 13, 13,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 13, 13, 0, 0, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 13, 13, 13,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 13, 13, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 9, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 13, 13,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 8, 7, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 0, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 9, 9, 9, 9, 3, 9, 9,
+	9, 9, 9, 9, 3, 9, 9, 3,
+	3, 3, 9, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	8, 8, 8, 8, 8, 8, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	8, 8, 8, 8, 8, 8, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	0, 8, 0, 8, 0, 8, 0, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 0, 7, 7,
+	8, 8, 8, 8, 8, 0, 7, 0,
+	0, 0, 7, 7, 7, 0, 7, 7,
+	8, 8, 8, 8, 8, 0, 0, 0,
+	7, 7, 7, 7, 0, 0, 7, 7,
+	8, 8, 8, 8, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 0, 0, 0,
+	0, 0, 7, 7, 7, 0, 7, 7,
+	8, 8, 8, 8, 8, 0, 0, 0,
+	6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 5, 3, 3, 5, 5,
+	0, 0, 0, 12, 12, 0, 0, 0,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	0, 0, 0, 0, 11, 0, 0, 0,
+	4, 4, 5, 5, 5, 5, 5, 6,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 14, 14, 0, 13, 13, 0, 0,
+	0, 0, 0, 0, 0, 14, 14, 13,
+	13, 13, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6,
+	5, 5, 5, 5, 5, 0, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	0, 7, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 14, 14, 7,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 14, 14, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 8, 0, 0, 0, 0, 8,
+	0, 0, 7, 8, 8, 8, 7, 7,
+	8, 8, 8, 7, 0, 8, 0, 0,
+	0, 8, 8, 8, 8, 8, 0, 0,
+	0, 0, 0, 0, 8, 0, 8, 0,
+	8, 0, 8, 8, 8, 8, 0, 7,
+	8, 8, 8, 8, 7, 9, 9, 9,
+	9, 7, 0, 0, 7, 7, 8, 8,
+	0, 0, 0, 0, 0, 8, 7, 7,
+	7, 7, 0, 0, 0, 0, 7, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	9, 9, 9, 8, 7, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	14, 14, 14, 14, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 14, 14, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 14, 14, 14, 14, 14,
+	14, 0, 0, 0, 0, 0, 0, 0,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 14, 14, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	14, 14, 14, 14, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 14, 14, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 7, 8, 8, 8, 7, 7, 8,
+	7, 8, 7, 8, 7, 8, 8, 8,
+	8, 7, 8, 7, 7, 8, 7, 7,
+	7, 7, 7, 7, 7, 7, 8, 8,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 7, 0, 0, 0,
+	0, 0, 0, 8, 7, 8, 7, 3,
+	3, 3, 8, 7, 0, 0, 0, 0,
+	0, 13, 13, 13, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 0, 7,
+	0, 0, 0, 0, 0, 7, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 14, 14, 0, 0,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 0, 0, 0, 0, 13, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 13, 0, 0, 0,
+	0, 0, 14, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 13, 13, 14, 14, 14,
+	14, 14, 14, 14, 14, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	6, 12, 13, 0, 0, 9, 9, 9,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 0, 0, 14, 14, 14, 14,
+	14, 14, 14, 14, 0, 14, 14, 14,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 3, 3,
+	0, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 3, 3, 0, 0, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 13,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 13, 13,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 9, 3,
+	3, 3, 3, 0, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 9,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 7, 7, 3, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 0, 13, 0, 0, 0, 13,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 8, 7, 8, 7, 8, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	9, 0, 0, 8, 7, 8, 7, 9,
+	8, 7, 8, 7, 7, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 8, 8, 8, 8, 7,
+	8, 8, 8, 8, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 8, 8, 8,
+	7, 8, 7, 8, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 7, 8, 7,
+	8, 7, 8, 7, 8, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7, 7, 7, 7, 8, 7, 9,
+	7, 7, 7, 9, 9, 9, 9, 9,
+	9, 9, 3, 9, 9, 9, 3, 9,
+	9, 9, 9, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 13, 13,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 9, 0, 9, 9, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 13,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	3, 3, 3, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	13, 13, 0, 0, 0, 0, 0, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 3, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 13, 13, 13,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 9, 3, 3, 3, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 9, 3, 3, 3, 9, 9, 3,
+	3, 9, 9, 9, 9, 9, 3, 3,
+	9, 3, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	13, 13, 9, 9, 9, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 9, 9, 9, 9, 9, 0,
+	0, 9, 9, 9, 9, 9, 9, 0,
+	0, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 0, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 0, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 13, 3, 3, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 9, 3, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 0, 9, 0,
+	9, 9, 0, 9, 9, 0, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 14, 14,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	12, 12, 13, 12, 12, 13, 13, 14,
+	14, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 12, 12, 0, 0, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 0, 0, 14,
+	14, 0, 0, 0, 0, 0, 0, 0,
+	12, 12, 11, 0, 12, 12, 13, 13,
+	12, 14, 14, 14, 14, 14, 14, 0,
+	0, 0, 0, 12, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 0, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 5,
+	0, 13, 0, 0, 0, 0, 0, 0,
+	14, 14, 0, 0, 12, 12, 11, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 12, 12, 0, 0, 0, 13,
+	0, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 14, 0, 14, 0, 0,
+	0, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 14, 0, 14, 0, 14,
+	14, 13, 14, 14, 12, 0, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	0, 0, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5, 5, 5, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 9, 9, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 0, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 0, 8, 8, 8, 8,
+	8, 8, 8, 0, 8, 8, 0, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 0, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 0, 7, 7, 7, 7, 7,
+	7, 7, 0, 7, 7, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	7, 9, 9, 7, 7, 7, 0, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 0, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 9,
+	9, 0, 0, 0, 9, 0, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 3, 3, 3, 0, 3, 3, 0,
+	0, 0, 0, 0, 3, 3, 3, 3,
+	9, 9, 9, 9, 0, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	3, 3, 3, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 9, 9, 9, 9, 9,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 0, 0,
+	0, 3, 3, 3, 3, 3, 0, 9,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 3, 3, 0, 0, 0,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 0, 0, 13, 13, 13,
+	13, 13, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 13, 13,
+	13, 13, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 13,
+	13, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	3, 9, 9, 3, 3, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 10, 13, 13,
+	13, 13, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 10, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	0, 13, 13, 13, 9, 3, 3, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 0, 0, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 9, 9, 9, 9, 13, 13, 0,
+	0, 3, 3, 3, 3, 13, 3, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 9, 0, 9, 0, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	13, 13, 0, 13, 13, 0, 3, 9,
+	9, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 0, 9, 9, 9, 9, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 13, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 9,
+	9, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 0, 9, 9, 9,
+	9, 9, 0, 3, 3, 9, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 3,
+	3, 0, 0, 3, 3, 3, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 9, 9, 9,
+	9, 9, 3, 3, 0, 0, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 9, 0, 0, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 9,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 3, 0, 0, 3, 0, 3,
+	3, 3, 3, 0, 3, 3, 3, 3,
+	3, 9, 3, 9, 13, 13, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 9,
+	9, 9, 9, 13, 13, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 3, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 9, 9, 0, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 13, 13, 0, 0, 0, 0,
+	0, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13,
+	9, 9, 9, 9, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 13, 13, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 13, 13, 13, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 9, 0, 0, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 0, 3,
+	3, 0, 0, 3, 3, 3, 3, 9,
+	3, 9, 3, 3, 13, 0, 13, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	3, 9, 0, 9, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 3,
+	3, 3, 9, 3, 3, 3, 3, 0,
+	0, 0, 13, 13, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 0, 13, 13, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	9, 13, 13, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 3, 0, 3, 3, 0, 3,
+	3, 3, 3, 3, 3, 3, 9, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 0, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 3, 3, 3, 3, 3, 0,
+	3, 3, 0, 3, 3, 3, 3, 3,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 3, 3, 3, 3, 13,
+	13, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 9, 3, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 0, 3, 3,
+	3, 3, 3, 13, 13, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	3, 9, 9, 9, 9, 9, 9, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 13, 13,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	3, 3, 3, 3, 3, 13, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	3, 3, 3, 3, 3, 3, 3, 13,
+	13, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 13, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 13, 13,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	13, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 0, 0, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 3,
+	9, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	3, 3, 3, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 0, 9, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 0, 9, 9, 9,
+	9, 9, 9, 9, 0, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 0, 0, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 0, 0, 3, 3, 13,
+	5, 5, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 3, 3,
+	3, 3, 0, 0, 0, 3, 3, 3,
+	3, 3, 3, 5, 5, 5, 5, 5,
+	5, 5, 5, 3, 3, 3, 3, 3,
+	3, 3, 3, 0, 0, 3, 3, 3,
+	3, 3, 3, 3, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 7, 7,
+	7, 7, 7, 7, 7, 0, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 0, 8, 8,
+	0, 0, 8, 0, 0, 8, 8, 0,
+	0, 8, 8, 8, 8, 0, 8, 8,
+	8, 8, 8, 8, 8, 8, 7, 7,
+	7, 7, 0, 7, 0, 7, 7, 7,
+	7, 7, 7, 7, 0, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 0, 8,
+	8, 8, 8, 0, 0, 8, 8, 8,
+	8, 8, 8, 8, 8, 0, 8, 8,
+	8, 8, 8, 8, 8, 0, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 0, 8, 8, 8, 8, 0,
+	8, 8, 8, 8, 8, 0, 8, 0,
+	0, 0, 8, 8, 8, 8, 8, 8,
+	8, 0, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 0, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 0, 7, 7, 7, 7,
+	7, 7, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 0, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 0, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 0, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 0,
+	7, 7, 7, 7, 7, 7, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 0, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 0, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 0, 7, 7, 7, 7,
+	7, 7, 8, 7, 0, 0, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0,
+	13, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 3, 3,
+	0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 9, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 0,
+	0, 0, 0, 0, 0, 7, 7, 7,
+	7, 7, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 0, 0, 3, 3, 3, 3, 3,
+	3, 3, 0, 3, 3, 0, 3, 3,
+	3, 3, 3, 0, 0, 0, 0, 0,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 3, 3, 3, 3,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	9, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 3, 9, 9, 3, 9,
+	9, 9, 9, 9, 9, 9, 3, 3,
+	9, 9, 9, 9, 9, 3, 0, 0,
+	0, 0, 0, 0, 0, 0, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 0, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 3, 3, 3, 3,
+	3, 3, 3, 9, 0, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 0, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 9, 9, 0, 9, 0, 0, 9,
+	0, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 9, 9, 9, 9,
+	0, 9, 0, 9, 0, 0, 0, 0,
+	0, 0, 9, 0, 0, 0, 0, 9,
+	0, 9, 0, 9, 0, 9, 9, 9,
+	0, 9, 9, 0, 9, 0, 0, 9,
+	0, 9, 0, 9, 0, 9, 0, 9,
+	0, 9, 9, 0, 9, 0, 0, 9,
+	9, 9, 9, 0, 9, 9, 9, 9,
+	9, 9, 9, 0, 9, 9, 9, 9,
+	0, 9, 9, 9, 9, 0, 9, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 9, 9, 9, 0, 9, 9, 9,
+	9, 9, 0, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 0, 0, 0, 0, 0, 0,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 14, 14,
+	14, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9,
+	0, 5, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0
+};
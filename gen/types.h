@@ -13,4 +13,11 @@ struct break_test {
 	char *descr;
 };
 
+struct segment_properties {
+	uint_least8_t char_break;
+	uint_least8_t word_break;
+	uint_least8_t sentence_break;
+	uint_least8_t line_break;
+};
+
 #endif /* TYPES_H */
@@ -451,9 +451,9 @@ properties_get_major_minor(const struct properties_compressed *comp,
 	return (double)compression_count / 0x1100 * 100;
 }
 
-void
-properties_print_lookup_table(const char *name, const size_t *data,
-                              size_t datalen)
+static void
+print_lookup_table(const char *qualifier, const char *name,
+                   const size_t *data, size_t datalen)
 {
 	const char *type;
 	size_t i, maxval;
@@ -469,7 +469,7 @@ properties_print_lookup_table(const char *name, const size_t *data,
 	       (maxval <= UINT_LEAST32_MAX) ? "uint_least32_t" :
 	                                      "uint_least64_t";
 
-	printf("static const %s %s[] = {\n\t", type, name);
+	printf("%s%s %s[] = {\n\t", qualifier, type, name);
 	for (i = 0; i < datalen; i++) {
 		printf("%zu", data[i]);
 		if (i + 1 == datalen) {
@@ -483,6 +483,21 @@ properties_print_lookup_table(const char *name, const size_t *data,
 	printf("};\n");
 }
 
+void
+properties_print_lookup_table(const char *name, const size_t *data,
+                              size_t datalen)
+{
+	print_lookup_table("static const ", name, data, datalen);
+}
+
+void
+properties_print_shared_lookup_table(const char *name, const size_t *data,
+                                     size_t datalen)
+{
+	/* the table is defined once and declared in the library sources */
+	print_lookup_table("const ", name, data, datalen);
+}
+
 void
 properties_print_derived_lookup_table(
 	char *name, size_t *offset, size_t offsetlen,
@@ -0,0 +1,140 @@
+/* See LICENSE file for copyright and license details. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "util.h"
+
+#define FILE_EAW      "data/EastAsianWidth.txt"
+#define FILE_GRAPHEME "data/GraphemeBreakProperty.txt"
+
+static const struct property_spec width_property[] = {
+	{
+		.enumname = "NARROW",
+		.file = NULL,
+		.ucdname = NULL,
+	},
+	/*
+	 * The general category is only given in the comments of
+	 * EastAsianWidth.txt, which are also matched. The zero-width
+	 * classes have to come before the wide classes, as there are
+	 * nonspacing marks with an East Asian width of W that only
+	 * match the first fitting class.
+	 */
+	{
+		.enumname = "ZERO",
+		.file = FILE_EAW,
+		.ucdname = "Mn",
+	},
+	{
+		.enumname = "TMP_ME",
+		.file = FILE_EAW,
+		.ucdname = "Me",
+	},
+	{
+		.enumname = "TMP_CF",
+		.file = FILE_EAW,
+		.ucdname = "Cf",
+	},
+	{
+		.enumname = "TMP_CC",
+		.file = FILE_EAW,
+		.ucdname = "Cc",
+	},
+	{
+		.enumname = "WIDE",
+		.file = FILE_EAW,
+		.ucdname = "W",
+	},
+	{
+		.enumname = "TMP_F",
+		.file = FILE_EAW,
+		.ucdname = "F",
+	},
+	/*
+	 * medial vowels and final consonants of conjoining hangul
+	 * syllables do not occupy a column of their own
+	 */
+	{
+		.enumname = "TMP_HANGUL_V",
+		.file = FILE_GRAPHEME,
+		.ucdname = "V",
+	},
+	{
+		.enumname = "TMP_HANGUL_T",
+		.file = FILE_GRAPHEME,
+		.ucdname = "T",
+	},
+};
+
+static const char *
+get_target(uint_least8_t prop)
+{
+	if (!strcmp(width_property[prop].enumname, "TMP_ME") ||
+	    !strcmp(width_property[prop].enumname, "TMP_CF") ||
+	    !strcmp(width_property[prop].enumname, "TMP_CC") ||
+	    !strcmp(width_property[prop].enumname, "TMP_HANGUL_V") ||
+	    !strcmp(width_property[prop].enumname, "TMP_HANGUL_T")) {
+		return "ZERO";
+	} else if (!strcmp(width_property[prop].enumname, "TMP_F")) {
+		return "WIDE";
+	} else {
+		return width_property[prop].enumname;
+	}
+}
+
+static uint_least8_t
+get_index(const char *enumname)
+{
+	uint_least8_t result;
+
+	for (result = 0; result < LEN(width_property); result++) {
+		if (!strcmp(width_property[result].enumname, enumname)) {
+			break;
+		}
+	}
+	if (result == LEN(width_property)) {
+		fprintf(stderr, "get_index: Internal error.\n");
+		exit(1);
+	}
+
+	return result;
+}
+
+static uint_least8_t
+handle_conflict(uint_least32_t cp, uint_least8_t prop1, uint_least8_t prop2)
+{
+	(void)cp;
+
+	/* a zero width always takes precedence */
+	if (!strcmp(get_target(prop1), "ZERO") ||
+	    !strcmp(get_target(prop2), "ZERO")) {
+		return get_index("ZERO");
+	} else {
+		fprintf(stderr, "handle_conflict: Cannot handle conflict.\n");
+		exit(1);
+	}
+}
+
+static void
+post_process(struct properties *prop)
+{
+	size_t i;
+
+	/* map the temporary classes to their final classes */
+	for (i = 0; i < UINT32_C(0x110000); i++) {
+		prop[i].property = get_index(get_target(prop[i].property));
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	(void)argc;
+
+	properties_generate_break_property(
+		width_property, LEN(width_property), NULL, handle_conflict,
+		post_process, "width", argv[0]);
+
+	return 0;
+}
@@ -0,0 +1,13616 @@
+/* Automatically generated by gen/word-test */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../gen/types.h"
+
+static const struct break_test word_break_test[] = {
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000B), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <LINE TABULATION> (Newline) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000300), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMBINING GRAVE ACCENT (Extend) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000AD), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SOFT HYPHEN (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [13.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) × [13.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0024C2), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00002E), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] FULL STOP (MidNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [8.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [8.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [10.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [4.0] COMBINING DIAERESIS (Extend) × [8.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00005F), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LOW LINE (ExtendNumLet) × [4.0] COMBINING DIAERESIS (Extend) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [15.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) × [15.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [7.1] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [7.1] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000022), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] QUOTATION MARK (Double_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [3.3] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [3.3] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0000A9), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] COPYRIGHT SIGN (ExtPictmALetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [3.4] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00000B) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000300) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0000AD) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0024C2) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000041) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00003A) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00002C) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00002E) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000030) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00005F) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x01F1E6) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0005D0) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000022) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x00200D) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x0000A9) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000020) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000000) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000000), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] <NULL> (XXmExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [9.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 5, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 5, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 7,
+		.len    = (size_t[]){ 5, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 5, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [6.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [7.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 7,
+		.len    = (size_t[]){ 1, 3, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x000027), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] APOSTROPHE (Single_Quote) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00000D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00000A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00000B) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000300) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x0000AD) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x003031) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x0024C2) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00005F) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x01F1E6) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000022) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000027) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00200D) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x0000A9) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000000) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 1, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 1, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 3, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 3, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] COMMA (MidNum) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000D) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <CARRIAGE RETURN (CR)> (CR) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00000B) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00000B) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [3.2] <LINE TABULATION> (Newline) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000300) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000300) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] COMBINING GRAVE ACCENT (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x0000AD) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0000AD) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] SOFT HYPHEN (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x003031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x003031) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x0024C2) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0024C2) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] CIRCLED LATIN CAPITAL LETTER M (ALetter_ExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000041) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00003A) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00002C) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00002E) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00002E) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] FULL STOP (MidNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000030) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00005F) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00005F) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x01F1E6) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x01F1E6) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x0005D0) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0005D0) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000022) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000022) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] QUOTATION MARK (Double_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000027) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x00200D) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 3 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x00200D) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 4 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x0000A9) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x0000A9) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] COPYRIGHT SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000020) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000020) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000000) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000000) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 3, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] <NULL> (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00003A) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x000027), UINT32_C(0x002060) },
+		.cplen  = 7,
+		.len    = (size_t[]){ 1, 3, 1, 2 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] APOSTROPHE (Single_Quote) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000061), UINT32_C(0x00002C) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00003A) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 5, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x000027) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 5, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 4, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002C) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 5, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 4, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060), UINT32_C(0x000308), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x002060) },
+		.cplen  = 7,
+		.len    = (size_t[]){ 5, 2 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [12.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) × [4.0] COMBINING DIAERESIS (Extend) × [11.0] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) × [4.0] WORD JOINER (Format) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00000D), UINT32_C(0x00000A), UINT32_C(0x000061), UINT32_C(0x00000A), UINT32_C(0x000308) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 2, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] <CARRIAGE RETURN (CR)> (CR) × [3.0] <LINE FEED (LF)> (LF) ÷ [3.1] LATIN SMALL LETTER A (ALettermExtPict) ÷ [3.2] <LINE FEED (LF)> (LF) ÷ [3.1] COMBINING DIAERESIS (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000020), UINT32_C(0x00200D), UINT32_C(0x000646) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] SPACE (WSegSpace) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] ARABIC LETTER NOON (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000646), UINT32_C(0x00200D), UINT32_C(0x000020) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] ARABIC LETTER NOON (ALettermExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] SPACE (WSegSpace) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000671), UINT32_C(0x000644), UINT32_C(0x000631), UINT32_C(0x00064E), UINT32_C(0x000651), UINT32_C(0x00062D), UINT32_C(0x000650), UINT32_C(0x00064A), UINT32_C(0x000645), UINT32_C(0x000650), UINT32_C(0x000020), UINT32_C(0x0006DD), UINT32_C(0x000661) },
+		.cplen  = 13,
+		.len    = (size_t[]){ 10, 1, 2 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] ARABIC LETTER ALEF WASLA (ALettermExtPict) × [5.0] ARABIC LETTER LAM (ALettermExtPict) × [5.0] ARABIC LETTER REH (ALettermExtPict) × [4.0] ARABIC FATHA (Extend) × [4.0] ARABIC SHADDA (Extend) × [5.0] ARABIC LETTER HAH (ALettermExtPict) × [4.0] ARABIC KASRA (Extend) × [5.0] ARABIC LETTER YEH (ALettermExtPict) × [5.0] ARABIC LETTER MEEM (ALettermExtPict) × [4.0] ARABIC KASRA (Extend) ÷ [999.0] SPACE (WSegSpace) ÷ [999.0] ARABIC END OF AYAH (Numeric) × [8.0] ARABIC-INDIC DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000721), UINT32_C(0x000719), UINT32_C(0x000721), UINT32_C(0x000718), UINT32_C(0x00072A), UINT32_C(0x000710), UINT32_C(0x000020), UINT32_C(0x00070F), UINT32_C(0x00071D), UINT32_C(0x000717) },
+		.cplen  = 10,
+		.len    = (size_t[]){ 6, 1, 3 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] SYRIAC LETTER MIM (ALettermExtPict) × [5.0] SYRIAC LETTER ZAIN (ALettermExtPict) × [5.0] SYRIAC LETTER MIM (ALettermExtPict) × [5.0] SYRIAC LETTER WAW (ALettermExtPict) × [5.0] SYRIAC LETTER RISH (ALettermExtPict) × [5.0] SYRIAC LETTER ALAPH (ALettermExtPict) ÷ [999.0] SPACE (WSegSpace) ÷ [999.0] SYRIAC ABBREVIATION MARK (ALettermExtPict) × [5.0] SYRIAC LETTER YUDH (ALettermExtPict) × [5.0] SYRIAC LETTER HE (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00072C), UINT32_C(0x00070F), UINT32_C(0x00072B), UINT32_C(0x000712), UINT32_C(0x000718) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] SYRIAC LETTER TAW (ALettermExtPict) × [5.0] SYRIAC ABBREVIATION MARK (ALettermExtPict) × [5.0] SYRIAC LETTER SHIN (ALettermExtPict) × [5.0] SYRIAC LETTER BETH (ALettermExtPict) × [5.0] SYRIAC LETTER WAW (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000041), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) × [5.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00003A), UINT32_C(0x000041) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [6.0] COLON (MidLetter) × [7.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000027) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [7.1] APOSTROPHE (Single_Quote) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x0005D0), UINT32_C(0x000022), UINT32_C(0x0005D0) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] HEBREW LETTER ALEF (Hebrew_Letter) × [7.2] QUOTATION MARK (Double_Quote) × [7.3] HEBREW LETTER ALEF (Hebrew_Letter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x000030), UINT32_C(0x000030), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [9.0] DIGIT ZERO (Numeric) × [8.0] DIGIT ZERO (Numeric) × [10.0] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00002C), UINT32_C(0x000030) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) × [12.0] COMMA (MidNum) × [11.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000030), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000030) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ZERO (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ZERO (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x003031), UINT32_C(0x003031) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] VERTICAL KANA REPEAT MARK (Katakana) × [13.0] VERTICAL KANA REPEAT MARK (Katakana) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00005F), UINT32_C(0x000030), UINT32_C(0x00005F), UINT32_C(0x003031), UINT32_C(0x00005F) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ZERO (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] VERTICAL KANA REPEAT MARK (Katakana) × [13.1] LOW LINE (ExtendNumLet) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000041), UINT32_C(0x00005F), UINT32_C(0x00005F), UINT32_C(0x000041) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 4 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN CAPITAL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN CAPITAL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 2, 1, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [15.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 1, 2, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [16.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x00200D), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [16.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x00200D), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x000062) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 3, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [4.0] ZERO WIDTH JOINER (ZWJ) × [16.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) ÷ [999.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x01F1E6), UINT32_C(0x01F1E7), UINT32_C(0x01F1E8), UINT32_C(0x01F1E9), UINT32_C(0x000062) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 1, 2, 2, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER A (RI) × [16.0] REGIONAL INDICATOR SYMBOL LETTER B (RI) ÷ [999.0] REGIONAL INDICATOR SYMBOL LETTER C (RI) × [16.0] REGIONAL INDICATOR SYMBOL LETTER D (RI) ÷ [999.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F476), UINT32_C(0x01F3FF), UINT32_C(0x01F476) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] BABY (ExtPictmALetter) × [4.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend) ÷ [999.0] BABY (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F6D1), UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] OCTAGONAL SIGN (ExtPictmALetter) × [4.0] ZERO WIDTH JOINER (ZWJ) × [3.3] OCTAGONAL SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) × [3.3] OCTAGONAL SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x002701), UINT32_C(0x00200D), UINT32_C(0x002701) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] UPPER BLADE SCISSORS (XXmExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] UPPER BLADE SCISSORS (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00200D), UINT32_C(0x002701) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 2, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] ZERO WIDTH JOINER (ZWJ) ÷ [999.0] UPPER BLADE SCISSORS (XXmExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F476), UINT32_C(0x01F3FF), UINT32_C(0x000308), UINT32_C(0x00200D), UINT32_C(0x01F476), UINT32_C(0x01F3FF) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 6 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] BABY (ExtPictmALetter) × [4.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) × [3.3] BABY (ExtPictmALetter) × [4.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F6D1), UINT32_C(0x01F3FF) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] OCTAGONAL SIGN (ExtPictmALetter) × [4.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x01F6D1), UINT32_C(0x01F3FF) },
+		.cplen  = 3,
+		.len    = (size_t[]){ 3 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [3.3] OCTAGONAL SIGN (ExtPictmALetter) × [4.0] EMOJI MODIFIER FITZPATRICK TYPE-6 (Extend) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [3.3] OCTAGONAL SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x00200D), UINT32_C(0x01F6D1) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 2 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] ZERO WIDTH JOINER (ZWJ) × [3.3] OCTAGONAL SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x01F6D1), UINT32_C(0x01F6D1) },
+		.cplen  = 2,
+		.len    = (size_t[]){ 1, 1 },
+		.lenlen = 2,
+		.descr  = "÷ [0.2] OCTAGONAL SIGN (ExtPictmALetter) ÷ [999.0] OCTAGONAL SIGN (ExtPictmALetter) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000308), UINT32_C(0x00200D), UINT32_C(0x000308), UINT32_C(0x000062) },
+		.cplen  = 5,
+		.len    = (size_t[]){ 5 },
+		.lenlen = 1,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [4.0] COMBINING DIAERESIS (Extend) × [4.0] ZERO WIDTH JOINER (ZWJ) × [4.0] COMBINING DIAERESIS (Extend) × [5.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x000020), UINT32_C(0x000020), UINT32_C(0x000062) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 2, 1 },
+		.lenlen = 3,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] SPACE (WSegSpace) × [3.4] SPACE (WSegSpace) ÷ [999.0] LATIN SMALL LETTER B (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000031), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] DIGIT ONE (Numeric) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00003A), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COLON (MidLetter) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002E), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00003A), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COLON (MidLetter) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002E), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] FULL STOP (MidNumLet) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000031) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] DIGIT ONE (Numeric) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 4,
+		.len    = (size_t[]){ 1, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000031), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] DIGIT ONE (Numeric) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+	{
+		.cp     = (uint_least32_t[]){ UINT32_C(0x000061), UINT32_C(0x00005F), UINT32_C(0x000061), UINT32_C(0x00002C), UINT32_C(0x00002C), UINT32_C(0x000061) },
+		.cplen  = 6,
+		.len    = (size_t[]){ 3, 1, 1, 1 },
+		.lenlen = 4,
+		.descr  = "÷ [0.2] LATIN SMALL LETTER A (ALettermExtPict) × [13.1] LOW LINE (ExtendNumLet) × [13.2] LATIN SMALL LETTER A (ALettermExtPict) ÷ [999.0] COMMA (MidNum) ÷ [999.0] COMMA (MidNum) ÷ [999.0] LATIN SMALL LETTER A (ALettermExtPict) ÷ [0.3]",
+	},
+};
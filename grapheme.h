@@ -14,6 +14,41 @@ enum grapheme_bidirectional_direction {
 	GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL,
 };
 
+enum grapheme_segmentation_type {
+	GRAPHEME_SEGMENTATION_CHARACTER = 1 << 0,
+	GRAPHEME_SEGMENTATION_WORD = 1 << 1,
+	GRAPHEME_SEGMENTATION_SENTENCE = 1 << 2,
+	GRAPHEME_SEGMENTATION_LINE = 1 << 3,
+};
+
+struct grapheme_segmentation {
+	size_t count;
+	size_t *ends;
+	size_t endslen;
+};
+
+struct grapheme_bidirectional_paragraph {
+	size_t off;
+	size_t len;
+	enum grapheme_bidirectional_direction direction;
+};
+
+struct grapheme_bidirectional_run {
+	size_t off;
+	size_t len;
+	int_least8_t level;
+};
+
+struct grapheme_bidirectional_line {
+	size_t off;
+	size_t len;
+	size_t runoff;
+	size_t runcount;
+};
+
+bool grapheme_bidirectional_is_trivial(const uint_least32_t *, size_t);
+bool grapheme_bidirectional_is_trivial_utf8(const char *, size_t);
+
 size_t grapheme_bidirectional_get_line_embedding_levels(const uint_least32_t *,
                                                         size_t, int_least8_t *,
                                                         size_t);
@@ -21,14 +56,84 @@ size_t grapheme_bidirectional_get_line_embedding_levels(const uint_least32_t *,
 size_t grapheme_bidirectional_preprocess_paragraph(
 	const uint_least32_t *, size_t, enum grapheme_bidirectional_direction,
 	uint_least32_t *, size_t, enum grapheme_bidirectional_direction *);
+size_t grapheme_bidirectional_preprocess_paragraph_utf8(
+	const char *, size_t, enum grapheme_bidirectional_direction,
+	uint_least32_t *, size_t, enum grapheme_bidirectional_direction *);
+size_t grapheme_bidirectional_preprocess_paragraph_links(
+	const uint_least32_t *, size_t, enum grapheme_bidirectional_direction,
+	uint_least32_t *, size_t, uint_least32_t *,
+	enum grapheme_bidirectional_direction *);
+size_t grapheme_bidirectional_preprocess_paragraph_links_utf8(
+	const char *, size_t, enum grapheme_bidirectional_direction,
+	uint_least32_t *, size_t, uint_least32_t *,
+	enum grapheme_bidirectional_direction *);
+size_t grapheme_bidirectional_preprocess_document(
+	const uint_least32_t *, size_t, enum grapheme_bidirectional_direction,
+	uint_least32_t *, size_t, struct grapheme_bidirectional_paragraph *,
+	size_t, size_t *);
+size_t grapheme_bidirectional_preprocess_document_utf8(
+	const char *, size_t, enum grapheme_bidirectional_direction,
+	uint_least32_t *, size_t, struct grapheme_bidirectional_paragraph *,
+	size_t, size_t *);
+size_t grapheme_bidirectional_preprocess_document_compact(
+	const uint_least32_t *, size_t, enum grapheme_bidirectional_direction,
+	uint_least16_t *, size_t, uint_least32_t *, size_t, size_t *,
+	struct grapheme_bidirectional_paragraph *, size_t, size_t *);
+size_t grapheme_bidirectional_preprocess_document_compact_utf8(
+	const char *, size_t, enum grapheme_bidirectional_direction,
+	uint_least16_t *, size_t, uint_least32_t *, size_t, size_t *,
+	struct grapheme_bidirectional_paragraph *, size_t, size_t *);
+
+size_t grapheme_bidirectional_expand_states(const uint_least16_t *, size_t,
+                                            uint_least32_t *, size_t);
+
+size_t grapheme_bidirectional_get_byte_offset(const uint_least32_t *, size_t,
+                                              size_t);
+size_t grapheme_bidirectional_get_codepoint_offset(const uint_least32_t *,
+                                                   size_t, size_t);
 
 size_t grapheme_bidirectional_reorder_line(const uint_least32_t *,
                                            const uint_least32_t *, size_t,
                                            uint_least32_t *, size_t);
+size_t grapheme_bidirectional_reorder_line_clusters(const uint_least32_t *,
+                                                    const uint_least32_t *,
+                                                    size_t, uint_least32_t *,
+                                                    size_t);
+size_t grapheme_bidirectional_reorder_line_utf8(const char *,
+                                                const uint_least32_t *, size_t,
+                                                char *, size_t);
+size_t grapheme_bidirectional_reorder_line_map(const uint_least32_t *, size_t,
+                                               size_t *, size_t, size_t *,
+                                               size_t);
+size_t grapheme_bidirectional_reorder_line_runs(
+	const uint_least32_t *, size_t, struct grapheme_bidirectional_run *,
+	size_t);
+
+size_t grapheme_bidirectional_layout_paragraph(
+	const uint_least32_t *, size_t, enum grapheme_bidirectional_direction,
+	size_t, uint_least32_t *, size_t, struct grapheme_bidirectional_line *,
+	size_t, size_t *, struct grapheme_bidirectional_run *, size_t,
+	size_t *);
+size_t grapheme_bidirectional_layout_paragraph_utf8(
+	const char *, size_t, enum grapheme_bidirectional_direction, size_t,
+	uint_least32_t *, size_t, struct grapheme_bidirectional_line *, size_t,
+	size_t *, struct grapheme_bidirectional_run *, size_t, size_t *);
+
+int grapheme_caseless_compare(const uint_least32_t *, size_t,
+                              const uint_least32_t *, size_t);
+int grapheme_caseless_compare_utf8(const char *, size_t, const char *, size_t);
+uint_least64_t grapheme_caseless_hash(const uint_least32_t *, size_t,
+                                      uint_least64_t);
+uint_least64_t grapheme_caseless_hash_utf8(const char *, size_t,
+                                           uint_least64_t);
 
 size_t grapheme_decode_utf8(const char *, size_t, uint_least32_t *);
 size_t grapheme_encode_utf8(uint_least32_t, char *, size_t);
 
+size_t grapheme_fold_case(const uint_least32_t *, size_t, uint_least32_t *,
+                          size_t);
+size_t grapheme_fold_case_utf8(const char *, size_t, char *, size_t);
+
 bool grapheme_is_character_break(uint_least32_t, uint_least32_t,
                                  uint_least16_t *);
 
@@ -50,6 +155,11 @@ size_t grapheme_next_line_break_utf8(const char *, size_t);
 size_t grapheme_next_sentence_break_utf8(const char *, size_t);
 size_t grapheme_next_word_break_utf8(const char *, size_t);
 
+size_t grapheme_segment(const uint_least32_t *, size_t, unsigned int,
+                        struct grapheme_segmentation *);
+size_t grapheme_segment_utf8(const char *, size_t, unsigned int,
+                             struct grapheme_segmentation *);
+
 size_t grapheme_to_lowercase(const uint_least32_t *, size_t, uint_least32_t *,
                              size_t);
 size_t grapheme_to_titlecase(const uint_least32_t *, size_t, uint_least32_t *,
@@ -61,4 +171,34 @@ size_t grapheme_to_lowercase_utf8(const char *, size_t, char *, size_t);
 size_t grapheme_to_titlecase_utf8(const char *, size_t, char *, size_t);
 size_t grapheme_to_uppercase_utf8(const char *, size_t, char *, size_t);
 
+size_t grapheme_to_lowercase_inplace(uint_least32_t *, size_t);
+size_t grapheme_to_uppercase_inplace(uint_least32_t *, size_t);
+
+size_t grapheme_to_lowercase_inplace_utf8(char *, size_t);
+size_t grapheme_to_uppercase_inplace_utf8(char *, size_t);
+
+size_t grapheme_to_lowercase_batch(const uint_least32_t *const *,
+                                   const size_t *, size_t, uint_least32_t *,
+                                   size_t, size_t *);
+size_t grapheme_to_uppercase_batch(const uint_least32_t *const *,
+                                   const size_t *, size_t, uint_least32_t *,
+                                   size_t, size_t *);
+
+size_t grapheme_to_lowercase_batch_utf8(const char *const *, const size_t *,
+                                        size_t, char *, size_t, size_t *);
+size_t grapheme_to_uppercase_batch_utf8(const char *const *, const size_t *,
+                                        size_t, char *, size_t, size_t *);
+
+size_t grapheme_wrap_line(const uint_least32_t *, size_t, size_t, size_t *);
+size_t grapheme_wrap_paragraph(const uint_least32_t *, size_t, size_t, size_t *,
+                               size_t);
+size_t grapheme_wrap_update(const uint_least32_t *, size_t, size_t, size_t,
+                            size_t, size_t, size_t *, size_t, size_t);
+
+size_t grapheme_wrap_line_utf8(const char *, size_t, size_t, size_t *);
+size_t grapheme_wrap_paragraph_utf8(const char *, size_t, size_t, size_t *,
+                                    size_t);
+size_t grapheme_wrap_update_utf8(const char *, size_t, size_t, size_t, size_t,
+                                 size_t, size_t *, size_t, size_t);
+
 #endif /* GRAPHEME_H */
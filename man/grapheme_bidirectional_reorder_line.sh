@@ -0,0 +1,2 @@
+CLUSTERS="false" \
+	$SH man/template/reorder_line.sh
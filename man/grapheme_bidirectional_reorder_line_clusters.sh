@@ -0,0 +1,2 @@
+CLUSTERS="true" \
+	$SH man/template/reorder_line.sh
@@ -0,0 +1,2 @@
+ENCODING="codepoint" \
+	$SH man/template/caseless_compare.sh
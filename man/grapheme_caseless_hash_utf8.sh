@@ -0,0 +1,2 @@
+ENCODING="utf8" \
+	$SH man/template/caseless_hash.sh
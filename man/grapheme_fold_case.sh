@@ -0,0 +1,2 @@
+ENCODING="codepoint" \
+	$SH man/template/fold_case.sh
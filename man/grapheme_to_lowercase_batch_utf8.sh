@@ -0,0 +1,3 @@
+ENCODING="utf8" \
+CASE="lowercase" \
+	$SH man/template/to_case_batch.sh
@@ -0,0 +1,3 @@
+ENCODING="codepoint" \
+CASE="lowercase" \
+	$SH man/template/to_case_inplace.sh
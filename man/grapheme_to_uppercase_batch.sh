@@ -0,0 +1,3 @@
+ENCODING="codepoint" \
+CASE="uppercase" \
+	$SH man/template/to_case_batch.sh
@@ -0,0 +1,2 @@
+ENCODING="codepoint" \
+	$SH man/template/wrap_paragraph.sh
@@ -0,0 +1,2 @@
+ENCODING="utf8" \
+	$SH man/template/wrap_paragraph.sh
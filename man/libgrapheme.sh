@@ -42,8 +42,16 @@ a standard library. This makes it easy to use in bare metal environments.
 Every documented function's manual page provides a self-contained
 example illustrating the possible usage.
 .Sh SEE ALSO
+.Xr grapheme_bidirectional_reorder_line 3 ,
+.Xr grapheme_bidirectional_reorder_line_clusters 3 ,
+.Xr grapheme_caseless_compare 3 ,
+.Xr grapheme_caseless_compare_utf8 3 ,
+.Xr grapheme_caseless_hash 3 ,
+.Xr grapheme_caseless_hash_utf8 3 ,
 .Xr grapheme_decode_utf8 3 ,
 .Xr grapheme_encode_utf8 3 ,
+.Xr grapheme_fold_case 3 ,
+.Xr grapheme_fold_case_utf8 3 ,
 .Xr grapheme_is_character_break 3 ,
 .Xr grapheme_is_lowercase 3 ,
 .Xr grapheme_is_lowercase_utf8 3 ,
@@ -59,12 +67,28 @@ example illustrating the possible usage.
 .Xr grapheme_next_sentence_break_utf8 3 ,
 .Xr grapheme_next_word_break 3 ,
 .Xr grapheme_next_word_break_utf8 3 ,
+.Xr grapheme_segment 3 ,
+.Xr grapheme_segment_utf8 3 ,
 .Xr grapheme_to_lowercase 3 ,
 .Xr grapheme_to_lowercase_utf8 3 ,
+.Xr grapheme_to_lowercase_inplace 3 ,
+.Xr grapheme_to_lowercase_inplace_utf8 3 ,
+.Xr grapheme_to_lowercase_batch 3 ,
+.Xr grapheme_to_lowercase_batch_utf8 3 ,
 .Xr grapheme_to_titlecase 3 ,
 .Xr grapheme_to_titlecase_utf8 3
 .Xr grapheme_to_uppercase 3 ,
 .Xr grapheme_to_uppercase_utf8 3 ,
+.Xr grapheme_to_uppercase_inplace 3 ,
+.Xr grapheme_to_uppercase_inplace_utf8 3 ,
+.Xr grapheme_to_uppercase_batch 3 ,
+.Xr grapheme_to_uppercase_batch_utf8 3 ,
+.Xr grapheme_wrap_line 3 ,
+.Xr grapheme_wrap_line_utf8 3 ,
+.Xr grapheme_wrap_paragraph 3 ,
+.Xr grapheme_wrap_paragraph_utf8 3 ,
+.Xr grapheme_wrap_update 3 ,
+.Xr grapheme_wrap_update_utf8 3 ,
 .Sh STANDARDS
 .Nm
 is compliant with the Unicode ${UNICODE_VERSION} specification.
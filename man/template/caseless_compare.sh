@@ -0,0 +1,106 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_CASELESS_COMPARE$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_caseless_compare${SUFFIX}
+.Nd compare ${ARRAYTYPE}s case-insensitively
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft int
+.Fn grapheme_caseless_compare${SUFFIX} "const ${DATATYPE} *a" "size_t alen" "const ${DATATYPE} *b" "size_t blen"
+.Sh DESCRIPTION
+The
+.Fn grapheme_caseless_compare${SUFFIX}
+function compares the ${ARRAYTYPE}s
+.Va a
+of length
+.Va alen
+and
+.Va b
+of length
+.Va blen
+by their case foldings, as determined by
+.Xr grapheme_fold_case${SUFFIX} 3 .
+Both inputs are folded as they are read, such that no buffers are
+needed, and the comparison stops at the first difference.
+.Pp
+If
+.Va alen
+or
+.Va blen
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the respective
+${ARRAYTYPE} is interpreted to be NUL-terminated and processing
+stops when a NUL-byte is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_caseless_compare${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_caseless_compare${SUFFIX}
+function returns 0 if the case foldings of
+.Va a
+and
+.Va b
+are equal.
+Otherwise it returns -1 if the case folding of
+.Va a
+is smaller than that of
+.Va b ,
+comparing codepoint by codepoint with a prefix being smaller,
+and 1 if it is greater.
+EOF
+
+if [ "$ENCODING" = "utf8" ]; then
+cat << EOF
+.Sh EXAMPLES
+.Bd -literal
+/* cc (-static) -o example example.c -lgrapheme */
+#include <grapheme.h>
+#include <stdint.h>
+#include <stdio.h>
+
+int
+main(void)
+{
+	/* UTF-8 encoded input */
+	char *a = "Stra\\\\303\\\\237e", *b = "STRASSE";
+
+	if (grapheme_caseless_compare_utf8(a, SIZE_MAX, b, SIZE_MAX) == 0) {
+		printf("equal\\\\n");
+	}
+
+	return 0;
+}
+.Ed
+EOF
+fi
+
+cat << EOF
+.Sh SEE ALSO
+.Xr grapheme_caseless_compare${ANTISUFFIX} 3 ,
+.Xr grapheme_fold_case${SUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_caseless_compare${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
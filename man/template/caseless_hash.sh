@@ -0,0 +1,73 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_CASELESS_HASH$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_caseless_hash${SUFFIX}
+.Nd hash ${ARRAYTYPE} case-insensitively
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft uint_least64_t
+.Fn grapheme_caseless_hash${SUFFIX} "const ${DATATYPE} *str" "size_t len" "uint_least64_t seed"
+.Sh DESCRIPTION
+The
+.Fn grapheme_caseless_hash${SUFFIX}
+function computes a 64-bit hash of the case folding of the
+${ARRAYTYPE}
+.Va str
+of length
+.Va len ,
+as determined by
+.Xr grapheme_fold_case${SUFFIX} 3 ,
+without storing the case folding.
+Strings that are equal according to
+.Xr grapheme_caseless_compare${SUFFIX} 3
+have the same hash for the same
+.Va seed ,
+which makes it suitable for hash tables with case-insensitive keys.
+The hash is the same for a string given as a codepoint array and
+as a UTF-8-encoded string.
+It is not a cryptographic hash.
+.Pp
+If
+.Va len
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the ${ARRAYTYPE}
+.Va str
+is interpreted to be NUL-terminated and processing stops when a
+NUL-byte is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_caseless_hash${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_caseless_hash${SUFFIX}
+function returns the hash of
+.Va str .
+.Sh SEE ALSO
+.Xr grapheme_caseless_compare${SUFFIX} 3 ,
+.Xr grapheme_caseless_hash${ANTISUFFIX} 3 ,
+.Xr grapheme_fold_case${SUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_caseless_hash${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,86 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_FOLD_CASE$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_fold_case${SUFFIX}
+.Nd fold case of ${ARRAYTYPE}
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_fold_case${SUFFIX} "const ${DATATYPE} *src" "size_t srclen" "${DATATYPE} *dest" "size_t destlen"
+.Sh DESCRIPTION
+The
+.Fn grapheme_fold_case${SUFFIX}
+function folds the case of the ${ARRAYTYPE}
+.Va src
+and writes the result to
+.Va dest
+up to
+.Va destlen ,
+unless
+.Va dest
+is set to
+.Dv NULL .
+.Pp
+Two strings that only differ in case have the same case folding.
+Each codepoint is mapped to the lowercase of the uppercase of its
+lowercase, which, unlike the lowercase alone, also unifies
+sequences like
+.Sq \(ss
+and
+.Sq ss
+or the final and non-final sigma.
+Following the case folding of the Unicode standard, the dotless i
+(U+0131) is left as is and Cherokee is folded to its uppercase.
+No context is taken into account.
+.Pp
+If
+.Va srclen
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the ${ARRAYTYPE}
+.Va src
+is interpreted to be NUL-terminated and processing stops when a
+NUL-byte is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_fold_case${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_fold_case${SUFFIX}
+function returns the number of ${UNIT}s in the array resulting
+from folding the case of
+.Va src ,
+even if
+.Va destlen
+is not large enough or
+.Va dest
+is
+.Dv NULL .
+.Sh SEE ALSO
+.Xr grapheme_caseless_compare${SUFFIX} 3 ,
+.Xr grapheme_fold_case${ANTISUFFIX} 3 ,
+.Xr grapheme_to_lowercase${SUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_fold_case${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,95 @@
+if [ "$CLUSTERS" = "true" ]; then
+	SUFFIX="_clusters"
+	ANTISUFFIX=""
+else
+	SUFFIX=""
+	ANTISUFFIX="_clusters"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_BIDIRECTIONAL_REORDER_LINE$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_bidirectional_reorder_line${SUFFIX}
+.Nd reorder a line of bidirectional text into display order
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_bidirectional_reorder_line${SUFFIX} "const uint_least32_t *line" "const uint_least32_t *linedata" "size_t linelen" "uint_least32_t *output" "size_t outputsize"
+.Sh DESCRIPTION
+The
+.Fn grapheme_bidirectional_reorder_line${SUFFIX}
+function writes the codepoints of the line
+.Va line
+of length
+.Va linelen
+in display order to the codepoint array
+.Va output
+of size
+.Va outputsize .
+The array
+.Va linedata
+contains the states of the line, as written for its paragraph by
+.Fn grapheme_bidirectional_preprocess_paragraph ,
+beginning at the offset of the line within the paragraph.
+.Pp
+The levels of the line are determined according to rule L1 of the
+Unicode Bidirectional Algorithm and the line is reordered according
+to rule L2, where mirrored codepoints at right-to-left levels are
+replaced by their mirror images (rule L4).
+The codepoints removed by rule X9 are not written to
+.Va output .
+EOF
+
+if [ "$CLUSTERS" = "true" ]; then
+cat << EOF
+.Pp
+In addition, each grapheme cluster (see
+.Xr grapheme_next_character_break 3 )
+whose codepoints all have the same reversed level is restored to its
+logical order after rule L2, such that, for instance, combining marks
+are displayed after their base character.
+This grapheme cluster reinversion is only done by
+.Fn grapheme_bidirectional_reorder_line_clusters ,
+while
+.Xr grapheme_bidirectional_reorder_line 3
+keeps the order of rule L2 unchanged.
+EOF
+else
+cat << EOF
+.Pp
+The codepoints are reordered individually, i.e. the codepoints of a
+grapheme cluster at a reversed level are reversed as well, and the
+order is the one of rule L2 without any grapheme cluster
+reinversion.
+.Xr grapheme_bidirectional_reorder_line_clusters 3
+can be used to keep the grapheme clusters in their logical order
+instead.
+EOF
+fi
+
+cat << EOF
+.Pp
+The sequences reversed by rule L2 are determined in a single pass
+over the line, but a codepoint is moved once for each enclosing
+sequence that is reversed, such that the reordering takes time
+proportional to the length of the line times the nesting depth of
+its levels.
+.Sh RETURN VALUES
+The
+.Fn grapheme_bidirectional_reorder_line${SUFFIX}
+function returns the number of codepoints in display order.
+If it is not smaller than
+.Va outputsize ,
+.Va output
+is filled with
+.Dv GRAPHEME_INVALID_CODEPOINT
+instead.
+.Sh SEE ALSO
+.Xr grapheme_bidirectional_reorder_line${ANTISUFFIX} 3 ,
+.Xr grapheme_next_character_break 3 ,
+.Xr libgrapheme 7
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,138 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_SEGMENT$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_segment${SUFFIX}
+.Nd determine multiple segmentations in a single pass
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_segment${SUFFIX} "const ${DATATYPE} *str" "size_t len" "unsigned int segmentations" "struct grapheme_segmentation *seg"
+.Sh DESCRIPTION
+The
+.Fn grapheme_segment${SUFFIX}
+function determines the character, word, sentence and line
+segmentations of the ${ARRAYTYPE}
+.Va str
+of length
+.Va len
+in a single pass, with the same results as iterating over it with
+.Xr grapheme_next_character_break${SUFFIX} 3 ,
+.Xr grapheme_next_word_break${SUFFIX} 3 ,
+.Xr grapheme_next_sentence_break${SUFFIX} 3
+and
+.Xr grapheme_next_line_break${SUFFIX} 3
+respectively.
+The text is processed paragraph by paragraph, such that each
+paragraph is decoded only once for all segmentations.
+.Pp
+The segmentations to determine are selected with the bitmask
+.Va segmentations ,
+a bitwise OR of
+.Dv GRAPHEME_SEGMENTATION_CHARACTER ,
+.Dv GRAPHEME_SEGMENTATION_WORD ,
+.Dv GRAPHEME_SEGMENTATION_SENTENCE
+and
+.Dv GRAPHEME_SEGMENTATION_LINE .
+The results are stored in the array
+.Va seg
+of four elements, one for each of the segmentations in the given
+order, of the form
+.Bd -literal
+struct grapheme_segmentation {
+	size_t count;
+	size_t *ends;
+	size_t endslen;
+};
+.Ed
+.Pp
+For each selected segmentation, the number of segments is stored in
+.Va count .
+If
+.Va ends
+is not
+.Dv NULL ,
+the offsets (in ${UNIT}s) to the ends of the first
+.Va endslen
+segments are additionally written to it.
+The elements of
+.Va seg
+for the segmentations that are not selected are left untouched.
+.Pp
+If
+.Va len
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the string
+.Va str
+is interpreted to be NUL-terminated and processing stops when
+a $(if [ "$ENCODING" = "utf8" ]; then printf "NUL-byte"; else printf "codepoint with the value 0"; fi) is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_segment${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_segment${SUFFIX}
+function returns the number of ${UNIT}s processed in
+.Va str .
+EOF
+
+if [ "$ENCODING" = "utf8" ]; then
+cat << EOF
+.Sh EXAMPLES
+.Bd -literal
+/* cc (-static) -o example example.c -lgrapheme */
+#include <grapheme.h>
+#include <stdint.h>
+#include <stdio.h>
+
+int
+main(void)
+{
+	/* UTF-8 encoded input */
+	char *s = "The quick brown fox. It jumps\\\\nover the lazy dog.";
+	struct grapheme_segmentation seg[4] = { 0 };
+
+	grapheme_segment_utf8(s, SIZE_MAX,
+	                      GRAPHEME_SEGMENTATION_CHARACTER |
+	                      GRAPHEME_SEGMENTATION_WORD |
+	                      GRAPHEME_SEGMENTATION_SENTENCE, seg);
+	printf("characters: %zu, words: %zu, sentences: %zu\\\\n",
+	       seg[0].count, seg[1].count, seg[2].count);
+
+	return 0;
+}
+.Ed
+EOF
+fi
+
+cat << EOF
+.Sh SEE ALSO
+.Xr grapheme_next_character_break${SUFFIX} 3 ,
+.Xr grapheme_next_line_break${SUFFIX} 3 ,
+.Xr grapheme_next_sentence_break${SUFFIX} 3 ,
+.Xr grapheme_next_word_break${SUFFIX} 3 ,
+.Xr grapheme_segment${ANTISUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_segment${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,107 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_TO_$(printf "%s_BATCH%s" "$CASE" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_to_${CASE}_batch${SUFFIX}
+.Nd convert many ${ARRAYTYPE}s to ${CASE} at once
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_to_${CASE}_batch${SUFFIX} "const ${DATATYPE} *const *src" "const size_t *srclen" "size_t count" "${DATATYPE} *dest" "size_t destlen" "size_t *ends"
+.Sh DESCRIPTION
+The
+.Fn grapheme_to_${CASE}_batch${SUFFIX}
+function converts the
+.Va count
+${ARRAYTYPE}s
+.Va src[0] ,
+\\&...,
+.Va src[count - 1]
+with the respective lengths
+.Va srclen[0] ,
+\\&...,
+.Va srclen[count - 1]
+to ${CASE} and writes the results back-to-back to
+.Va dest
+up to
+.Va destlen ,
+unless
+.Va dest
+is set to
+.Dv NULL .
+Only the end of the last result is NUL-terminated.
+Each string is converted as with
+.Xr grapheme_to_${CASE}${SUFFIX} 3 ,
+but the per-call overhead is only incurred once for all of them.
+.Pp
+If
+.Va ends
+is not
+.Dv NULL ,
+the offset in ${UNIT}s of the end of the ${CASE} of
+.Va src[i]
+in
+.Va dest
+is stored in
+.Va ends[i] ,
+which also marks the start of the ${CASE} of
+.Va src[i + 1] .
+The offsets are stored even if
+.Va destlen
+is not large enough or
+.Va dest
+is
+.Dv NULL .
+.Pp
+If
+.Va srclen[i]
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the ${ARRAYTYPE}
+.Va src[i]
+is interpreted to be NUL-terminated and its processing stops when a
+NUL-byte is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_to_${CASE}_batch${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_to_${CASE}_batch${SUFFIX}
+function returns the total number of ${UNIT}s of the ${CASE}s of all
+strings, excluding the terminating NUL, even if
+.Va destlen
+is not large enough or
+.Va dest
+is
+.Dv NULL .
+Calling it first with
+.Va dest
+set to
+.Dv NULL
+thus determines the size of the buffer that has to be allocated for
+all results, which is one more than the returned value.
+.Sh SEE ALSO
+.Xr grapheme_to_${CASE}${SUFFIX} 3 ,
+.Xr grapheme_to_${CASE}_batch${ANTISUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_to_${CASE}_batch${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
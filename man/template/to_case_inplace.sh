@@ -0,0 +1,71 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_TO_$(printf "%s_INPLACE%s" "$CASE" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_to_${CASE}_inplace${SUFFIX}
+.Nd convert ${ARRAYTYPE} to ${CASE} in place
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_to_${CASE}_inplace${SUFFIX} "${DATATYPE} *str" "size_t len"
+.Sh DESCRIPTION
+The
+.Fn grapheme_to_${CASE}_inplace${SUFFIX}
+function converts the ${ARRAYTYPE}
+.Va str
+of length
+.Va len
+to ${CASE} by overwriting it.
+Conversion stops before the first character whose ${CASE} has a
+different length in ${UNIT}s, as it would not fit in place.
+The remainder of
+.Va str
+is left unchanged and can be converted with
+.Xr grapheme_to_${CASE}${SUFFIX} 3 .
+.Pp
+If
+.Va len
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the ${ARRAYTYPE}
+.Va str
+is interpreted to be NUL-terminated and processing stops when a
+NUL-byte is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_to_${CASE}_inplace${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_to_${CASE}_inplace${SUFFIX}
+function returns the number of ${UNIT}s of
+.Va str
+that have been converted to ${CASE}.
+If it is smaller than the length of
+.Va str ,
+the conversion stopped early at the returned offset.
+.Sh SEE ALSO
+.Xr grapheme_to_${CASE}${SUFFIX} 3 ,
+.Xr grapheme_to_${CASE}_inplace${ANTISUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_to_${CASE}_inplace${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,120 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_WRAP_LINE$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_wrap_line${SUFFIX}
+.Nd determine ${UNIT}-offset to the next line of a text wrapped to a given width
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_wrap_line${SUFFIX} "const ${DATATYPE} *str" "size_t len" "size_t columns" "size_t *linelen"
+.Sh DESCRIPTION
+The
+.Fn grapheme_wrap_line${SUFFIX}
+function greedily fills a line of at most
+.Va columns
+columns with the beginning of the ${ARRAYTYPE}
+.Va str
+of length
+.Va len ,
+only breaking it at line break opportunities (see
+.Xr grapheme_next_line_break${SUFFIX} 3 )
+and always after a mandatory line break.
+.Pp
+The width of each grapheme cluster is the largest East Asian width
+of its codepoints, where wide and fullwidth codepoints take up two
+columns and nonspacing, enclosing, format and control codepoints
+take up no column at all.
+Spaces at the end of the line and the mandatory line break itself
+hang, i.e. they do not count towards the width of the line.
+If a segment between two line break opportunities does not fit into
+an otherwise empty line, it is broken at the last grapheme cluster
+boundary that still fits, but after at least one grapheme cluster.
+.Pp
+If
+.Va linelen
+is not
+.Dv NULL ,
+the length (in ${UNIT}s) of the line without the hanging
+codepoints is written to it.
+.Pp
+If
+.Va len
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the string
+.Va str
+is interpreted to be NUL-terminated and processing stops when
+a $(if [ "$ENCODING" = "utf8" ]; then printf "NUL-byte"; else printf "codepoint with the value 0"; fi) is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_wrap_line${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_wrap_line${SUFFIX}
+function returns the offset (in ${UNIT}s) to the beginning of the
+next line in
+.Va str
+or 0 if
+.Va str
+is
+.Dv NULL .
+EOF
+
+if [ "$ENCODING" = "utf8" ]; then
+cat << EOF
+.Sh EXAMPLES
+.Bd -literal
+/* cc (-static) -o example example.c -lgrapheme */
+#include <grapheme.h>
+#include <stdint.h>
+#include <stdio.h>
+
+int
+main(void)
+{
+	/* UTF-8 encoded input */
+	char *s = "The quick brown \\\\xE7\\\\x8B\\\\x90\\\\xE7\\\\x8B\\\\xB8 jumps "
+	          "over the lazy dog.\\\\nSupercalifragilisticexpialidocious";
+	size_t ret, len, off;
+
+	/* print the input wrapped to 12 columns */
+	for (off = 0; s[off] != '\\\\0'; off += ret) {
+		ret = grapheme_wrap_line_utf8(s + off, SIZE_MAX, 12, &len);
+		printf("|%.*s|\\\\n", (int)len, s + off);
+	}
+
+	return 0;
+}
+.Ed
+EOF
+fi
+
+cat << EOF
+.Sh SEE ALSO
+.Xr grapheme_next_line_break${SUFFIX} 3 ,
+.Xr grapheme_wrap_line${ANTISUFFIX} 3 ,
+.Xr grapheme_wrap_paragraph${SUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_wrap_line${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,101 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_WRAP_PARAGRAPH$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_wrap_paragraph${SUFFIX}
+.Nd wrap a paragraph to a given width with minimum raggedness
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_wrap_paragraph${SUFFIX} "const ${DATATYPE} *str" "size_t len" "size_t columns" "size_t *buf" "size_t buflen"
+.Sh DESCRIPTION
+The
+.Fn grapheme_wrap_paragraph${SUFFIX}
+function wraps the paragraph at the beginning of the ${ARRAYTYPE}
+.Va str
+of length
+.Va len ,
+which ends after the first mandatory line break, into lines of at
+most
+.Va columns
+columns.
+Unlike
+.Xr grapheme_wrap_line${SUFFIX} 3 ,
+which fills each line greedily, it chooses the line break
+opportunities (see
+.Xr grapheme_next_line_break${SUFFIX} 3 )
+such that the sum of the squared number of unused columns of all
+lines but the last is minimal, yielding a more even right margin.
+Widths, hanging spaces and the breaking of segments that are too wide
+for a line of their own are handled like in
+.Xr grapheme_wrap_line${SUFFIX} 3 .
+.Pp
+The array
+.Va buf
+of length
+.Va buflen
+is used as scratch space and needs to provide room for seven entries
+for each line break opportunity in the paragraph and seven more.
+As there are never more line break opportunities than ${UNIT}s,
+seven times the number of ${UNIT}s plus seven entries are always
+sufficient.
+On success the offsets (in ${UNIT}s) to the ends of the lines, which
+are also the beginnings of the respective following lines, are
+written to the beginning of
+.Va buf .
+.Pp
+If
+.Va len
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the string
+.Va str
+is interpreted to be NUL-terminated and processing stops when
+a $(if [ "$ENCODING" = "utf8" ]; then printf "NUL-byte"; else printf "codepoint with the value 0"; fi) is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_wrap_paragraph${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_wrap_paragraph${SUFFIX}
+function returns the number of lines the paragraph has been wrapped
+into, or 0 if
+.Va str
+is
+.Dv NULL
+or empty.
+If
+.Va buflen
+is too small, nothing is written to the beginning of
+.Va buf
+and the required buffer length is returned instead, which is always
+larger than
+.Va buflen ,
+while the number of lines is always smaller than it.
+.Sh SEE ALSO
+.Xr grapheme_next_line_break${SUFFIX} 3 ,
+.Xr grapheme_wrap_line${SUFFIX} 3 ,
+.Xr grapheme_wrap_paragraph${ANTISUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_wrap_paragraph${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
+EOF
@@ -0,0 +1,140 @@
+if [ "$ENCODING" = "utf8" ]; then
+	UNIT="byte"
+	ARRAYTYPE="UTF-8-encoded string"
+	SUFFIX="_utf8"
+	ANTISUFFIX=""
+	DATATYPE="char"
+else
+	UNIT="codepoint"
+	ARRAYTYPE="codepoint array"
+	SUFFIX=""
+	ANTISUFFIX="_utf8"
+	DATATYPE="uint_least32_t"
+fi
+
+cat << EOF
+.Dd ${MAN_DATE}
+.Dt GRAPHEME_WRAP_UPDATE$(printf "%s" "$SUFFIX" | tr [:lower:] [:upper:]) 3
+.Os suckless.org
+.Sh NAME
+.Nm grapheme_wrap_update${SUFFIX}
+.Nd incrementally rewrap a text after an edit
+.Sh SYNOPSIS
+.In grapheme.h
+.Ft size_t
+.Fn grapheme_wrap_update${SUFFIX} "const ${DATATYPE} *str" "size_t len" "size_t columns" "size_t off" "size_t oldlen" "size_t newlen" "size_t *buf" "size_t buflen" "size_t nlines"
+.Sh DESCRIPTION
+The
+.Fn grapheme_wrap_update${SUFFIX}
+function maintains the greedy wrapping of the ${ARRAYTYPE}
+.Va str
+of length
+.Va len
+into lines of at most
+.Va columns
+columns, as determined line by line by
+.Xr grapheme_wrap_line${SUFFIX} 3 ,
+across edits of the text.
+.Pp
+The array
+.Va buf
+of length
+.Va buflen
+holds two entries for each of the first
+.Va buflen
+/ 2 lines of the wrapped text, of which the first entry of line
+.Va i ,
+.Va buf Ns [2 *
+.Va i Ns ],
+is the offset (in ${UNIT}s) to the end of the line, which is also the
+beginning of the following line.
+The second entry is used internally and must not be modified.
+The number of lines of the text before the edit is passed as
+.Va nlines ,
+which is 0 to wrap a text from scratch.
+.Pp
+The edit is given as the replacement of the
+.Va oldlen
+${UNIT}s at offset
+.Va off
+of the old text with the
+.Va newlen
+${UNIT}s at offset
+.Va off
+of the new text
+.Va str .
+Only the lines that may be affected by it are wrapped again, up to the
+first line behind the edit that ends where a line of the old text did,
+after which the wrapping is known to be unchanged and the remaining
+line ends are only shifted.
+The result is identical to wrapping the new text from scratch.
+.Pp
+If
+.Va len
+is set to
+.Dv SIZE_MAX
+(stdint.h is already included by grapheme.h) the string
+.Va str
+is interpreted to be NUL-terminated and processing stops when
+a $(if [ "$ENCODING" = "utf8" ]; then printf "NUL-byte"; else printf "codepoint with the value 0"; fi) is encountered.
+.Pp
+For $(if [ "$ENCODING" != "utf8" ]; then printf "UTF-8-encoded"; else printf "non-UTF-8"; fi) input data
+.Xr grapheme_wrap_update${ANTISUFFIX} 3
+can be used instead.
+.Sh RETURN VALUES
+The
+.Fn grapheme_wrap_update${SUFFIX}
+function returns the number of lines of the new text.
+If it exceeds
+.Va buflen
+/ 2, only the first lines are stored in
+.Va buf
+and the lines behind them are wrapped again when the edit requires it.
+EOF
+
+if [ "$ENCODING" = "utf8" ]; then
+cat << EOF
+.Sh EXAMPLES
+.Bd -literal
+/* cc (-static) -o example example.c -lgrapheme */
+#include <grapheme.h>
+#include <stdio.h>
+#include <string.h>
+
+int
+main(void)
+{
+	char s[64] = "The quick brown fox jumps over the lazy dog.";
+	size_t buf[32], nlines, i;
+
+	/* wrap the text from scratch */
+	nlines = grapheme_wrap_update_utf8(s, strlen(s), 10, 0, 0, strlen(s),
+	                                   buf, 32, 0);
+
+	/* replace "quick" with "slow" and update the wrapping */
+	memmove(s + 8, s + 9, strlen(s + 9) + 1);
+	memcpy(s + 4, "slow", 4);
+	nlines = grapheme_wrap_update_utf8(s, strlen(s), 10, 4, 5, 4, buf, 32,
+	                                   nlines);
+
+	for (i = 0; i < nlines; i++) {
+		printf("line %zu ends at %zu\\\\n", i, buf[2 * i]);
+	}
+
+	return 0;
+}
+.Ed
+EOF
+fi
+
+cat << EOF
+.Sh SEE ALSO
+.Xr grapheme_wrap_line${SUFFIX} 3 ,
+.Xr grapheme_wrap_paragraph${SUFFIX} 3 ,
+.Xr grapheme_wrap_update${ANTISUFFIX} 3 ,
+.Xr libgrapheme 7
+.Sh STANDARDS
+.Fn grapheme_wrap_update${SUFFIX}
+is compliant with the Unicode ${UNICODE_VERSION} specification.
+.Sh AUTHORS
+.An Laslo Hunhold Aq Mt dev@frign.de
@@ -15,6 +15,8 @@ enum state_type {
 	STATE_LEVEL,           /* in 0..MAX_DEPTH+1=126, embedding level */
 	STATE_PARAGRAPH_LEVEL, /* in 0..1, paragraph embedding level */
 	STATE_VISITED,         /* in 0..1, visited within isolating run */
+	STATE_SOURCE_LEN,      /* in 1..4, source length of the codepoint */
+	STATE_BRACKET_PAIR,    /* in 0..3, bracket_pair, see N0 */
 };
 
 static struct {
@@ -52,6 +54,16 @@ static struct {
 		.mask_shift   = 26,
 		.value_offset = 0,
 	},
+	[STATE_SOURCE_LEN] = {
+		.filter_mask  = 0x38000000, /* 00111000 00000000 00000000 00000000 */
+		.mask_shift   = 27,
+		.value_offset = 0,
+	},
+	[STATE_BRACKET_PAIR] = {
+		.filter_mask  = 0xC0000000, /* 11000000 00000000 00000000 00000000 */
+		.mask_shift   = 30,
+		.value_offset = 0,
+	},
 };
 
 static inline int_least16_t
@@ -71,10 +83,50 @@ set_state(enum state_type t, int_least16_t value, uint_least32_t *output)
 	           state_lut[t].filter_mask;
 }
 
+/*
+ * Once a paragraph is resolved, the line functions only need the
+ * following states, which fit into 16 bits. The resolution itself
+ * needs all 32 bits of a state, so the compaction can only take
+ * place after it.
+ */
+static const struct {
+	enum state_type type;
+	uint_least16_t filter_mask;
+	size_t mask_shift;
+} compact_state_lut[] = {
+	{
+		.type = STATE_PRESERVED_PROP,
+		.filter_mask = 0x001F, /* 00000000 00011111 */
+		.mask_shift = 0,
+	},
+	{
+		.type = STATE_LEVEL,
+		.filter_mask = 0x0FE0, /* 00001111 11100000 */
+		.mask_shift = 5,
+	},
+	{
+		.type = STATE_PARAGRAPH_LEVEL,
+		.filter_mask = 0x1000, /* 00010000 00000000 */
+		.mask_shift = 12,
+	},
+	{
+		.type = STATE_SOURCE_LEN,
+		.filter_mask = 0xE000, /* 11100000 00000000 */
+		.mask_shift = 13,
+	},
+};
+
+enum bracket_pair {
+	BRACKET_PAIR_NONE = 0,  /* not a bracket of a pair to resolve */
+	BRACKET_PAIR_EMBEDDING, /* opening, resolved to embedding direction */
+	BRACKET_PAIR_CONTEXT,   /* opening, resolved by preceding context */
+	BRACKET_PAIR_CLOSING,   /* closing, resolved like its opening */
+};
+
 struct isolate_runner {
 	uint_least32_t *buf;
 	size_t buflen;
-	size_t start;
+	const uint_least32_t *links;
 
 	struct {
 		size_t off;
@@ -137,8 +189,9 @@ ir_set_current_prop(const struct isolate_runner *ir, enum bidi_property prop)
 }
 
 static void
-ir_init(uint_least32_t *buf, size_t buflen, size_t off,
-        uint_least8_t paragraph_level, bool within, struct isolate_runner *ir)
+ir_init(uint_least32_t *buf, size_t buflen, const uint_least32_t *links,
+        size_t off, uint_least8_t paragraph_level, bool within,
+        struct isolate_runner *ir)
 {
 	size_t i;
 	int_least8_t sos_level;
@@ -146,8 +199,8 @@ ir_init(uint_least32_t *buf, size_t buflen, size_t off,
 	/* initialize invariants */
 	ir->buf = buf;
 	ir->buflen = buflen;
+	ir->links = links;
 	ir->paragraph_level = paragraph_level;
-	ir->start = off;
 
 	/* advance off until we are at a non-removed character */
 	for (; off < buflen; off++) {
@@ -221,12 +274,38 @@ ir_init(uint_least32_t *buf, size_t buflen, size_t off,
 	}
 }
 
+static bool
+is_overflow_isolate(const uint_least32_t *buf, size_t buflen, size_t off)
+{
+	size_t i;
+	int_least8_t level;
+
+	/*
+	 * unlike the content of a valid isolate, the content of an
+	 * overflow isolate (X5a-X5c) has the level of its initiator
+	 */
+	for (i = off + 1; i < buflen; i++) {
+		level = (int_least8_t)get_state(STATE_LEVEL, buf[i]);
+
+		if (level == -1) {
+			/* ignored character */
+			continue;
+		}
+
+		return level <= (int_least8_t)get_state(STATE_LEVEL,
+		                                        buf[off]) &&
+		       get_state(STATE_PROP, buf[i]) != BIDI_PROP_PDI;
+	}
+
+	return false;
+}
+
 static int
 ir_advance(struct isolate_runner *ir)
 {
 	enum bidi_property prop;
-	int_least8_t level, isolate_level, last_isolate_level;
-	size_t i;
+	int_least8_t level, last_isolate_level;
+	size_t i, isolate_level;
 
 	if (ir->next.off == SIZE_MAX) {
 		/* the sequence is over */
@@ -264,9 +343,7 @@ ir_advance(struct isolate_runner *ir)
 			 * counter, but go into processing when we
 			 * were not isolated before
 			 */
-			if (isolate_level < MAX_DEPTH) {
-				isolate_level++;
-			}
+			isolate_level++;
 			if (isolate_level != 1) {
 				continue;
 			}
@@ -293,6 +370,21 @@ ir_advance(struct isolate_runner *ir)
 		 */
 		if (i == ir->cur.off) {
 			/* we were in the first initializing round */
+			if (isolate_level == 1 &&
+			    is_overflow_isolate(ir->buf, ir->buflen, i)) {
+				/*
+				 * the content continues the level run
+				 * (BD13), so we do not skip it
+				 */
+				isolate_level = 0;
+			} else if (isolate_level == 1 && ir->links != NULL) {
+				/* skip the isolate directly to its PDI */
+				if (ir->links[i] == UINT_LEAST32_MAX) {
+					i = ir->buflen - 1;
+				} else {
+					i += ir->links[i] - 1;
+				}
+			}
 			continue;
 		} else if (level == ir->isolating_run_level) {
 			/* isolate_level-skips have been handled before, we're
@@ -331,366 +423,247 @@ ir_advance(struct isolate_runner *ir)
 	return 0;
 }
 
-static enum bidi_property
-ir_get_last_strong_prop(const struct isolate_runner *ir)
-{
-	struct isolate_runner tmp;
-	enum bidi_property last_strong_prop = ir->sos, prop;
-
-	ir_init(ir->buf, ir->buflen, ir->start, ir->paragraph_level, false,
-	        &tmp);
-	for (; !ir_advance(&tmp) && tmp.cur.off < ir->cur.off;) {
-		prop = ir_get_current_prop(&tmp);
-
-		if (prop == BIDI_PROP_R || prop == BIDI_PROP_L ||
-		    prop == BIDI_PROP_AL) {
-			last_strong_prop = prop;
-		}
-	}
-
-	return last_strong_prop;
-}
-
-static enum bidi_property
-ir_get_last_strong_or_number_prop(const struct isolate_runner *ir)
-{
-	struct isolate_runner tmp;
-	enum bidi_property last_strong_or_number_prop = ir->sos, prop;
-
-	ir_init(ir->buf, ir->buflen, ir->start, ir->paragraph_level, false,
-	        &tmp);
-	for (; !ir_advance(&tmp) && tmp.cur.off < ir->cur.off;) {
-		prop = ir_get_current_prop(&tmp);
-
-		if (prop == BIDI_PROP_R || prop == BIDI_PROP_L ||
-		    prop == BIDI_PROP_AL || prop == BIDI_PROP_EN ||
-		    prop == BIDI_PROP_AN) {
-			last_strong_or_number_prop = prop;
-		}
-	}
-
-	return last_strong_or_number_prop;
-}
-
 static void
-preprocess_bracket_pair(const struct isolate_runner *start,
-                        const struct isolate_runner *end)
+preprocess_bracket_pairs(uint_least32_t *buf, size_t buflen,
+                         const uint_least32_t *links, size_t off,
+                         uint_least8_t paragraph_level)
 {
-	enum bidi_property prop, bracket_prop, last_strong_or_number_prop;
-	struct isolate_runner ir;
-	size_t strong_type_off;
-
 	/*
-	 * check if the bracket contains a strong type (L or R|EN|AN)
+	 * The N0-rule deals with bracket pairs that shall be determined
+	 * with the rule BD16. This is specified as an algorithm with a
+	 * stack of 63 bracket openings that are used to resolve into a
+	 * separate list of pairs, which is then to be sorted by opening
+	 * position and processed in this order. Thus, even though the
+	 * bracketing-depth is limited by 63, the algorithm, as is,
+	 * requires dynamic memory management for the list of pairs.
+	 *
+	 * We instead make two passes over the isolating run sequence:
+	 *
+	 * The first pass determines the bracket pairs with the BD16
+	 * stack, which is propagated whether a strong type (L or
+	 * R|EN|AN) has been encountered within each opening. Given
+	 * nothing within a pair is changed before it is processed (the
+	 * pairs within it come later in the order of openings), this
+	 * already determines if the pair is resolved to the embedding
+	 * direction, the preceding context or not at all. This is
+	 * stored in the otherwise unused state bits of both brackets,
+	 * which is why we need no list of pairs.
+	 *
+	 * The second pass resolves the marked pairs in the order of
+	 * their openings, keeping track of the last strong type or
+	 * number that precedes them. The pairs are nested within each
+	 * other, which is why the type of the opening bracket can be
+	 * passed on to the closing one with a stack of the same depth.
+	 *
+	 * Both passes are linear in the length of the sequence.
 	 */
-	for (ir = *start, strong_type_off = SIZE_MAX,
-	    bracket_prop = NUM_BIDI_PROPS;
-	     !ir_advance(&ir) && ir.cur.off < end->cur.off;) {
+	struct {
+		size_t off;
+		uint_least8_t bracket_class;
+		bool contains_l, contains_r;
+	} stack[63];
+	enum bidi_property prop, bracket_prop, last_strong_or_number_prop,
+		resolved[LEN(stack)], nsm_prop;
+	enum bracket_pair pair;
+	const struct bracket *bracket;
+	struct isolate_runner ir;
+	size_t stack_len, num_pairs, i;
+
+	/* BD16 */
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
+	for (stack_len = 0, num_pairs = 0; !ir_advance(&ir);) {
 		prop = ir_get_current_prop(&ir);
+		bracket = ir_get_current_bracket_prop(&ir);
 
-		if (prop == BIDI_PROP_L) {
-			strong_type_off = ir.cur.off;
-			if (ir.isolating_run_level % 2 == 0) {
-				/*
-				 * set the type for both brackets to L (so they
-				 * match the strong type they contain)
-				 */
-				bracket_prop = BIDI_PROP_L;
+		if (prop == BIDI_PROP_ON && bracket->type == BIDI_BRACKET_OPEN) {
+			if (stack_len == LEN(stack)) {
+				/* the stack is full, stop processing */
+				break;
+			}
+
+			/* push the opening bracket onto the stack */
+			stack[stack_len].off = ir.cur.off;
+			stack[stack_len].bracket_class = bracket->class;
+			stack[stack_len].contains_l = false;
+			stack[stack_len].contains_r = false;
+			stack_len++;
+		} else if (prop == BIDI_PROP_ON &&
+		           bracket->type == BIDI_BRACKET_CLOSE) {
+			/*
+			 * go down the stack and simply ignore (do
+			 * nothing) the closing bracket if we do not
+			 * match anything
+			 */
+			for (i = stack_len; i > 0; i--) {
+				if (stack[i - 1].bracket_class ==
+				    bracket->class) {
+					break;
+				}
+			}
+			if (i == 0) {
+				continue;
 			}
-		} else if (prop == BIDI_PROP_R || prop == BIDI_PROP_EN ||
-		           prop == BIDI_PROP_AN) {
-			strong_type_off = ir.cur.off;
-			if (ir.isolating_run_level % 2 != 0) {
+
+			/*
+			 * pop all openings above the matching one,
+			 * which are within the pair
+			 */
+			for (; stack_len > i; stack_len--) {
+				stack[stack_len - 2].contains_l |=
+					stack[stack_len - 1].contains_l;
+				stack[stack_len - 2].contains_r |=
+					stack[stack_len - 1].contains_r;
+			}
+
+			/* determine how the pair is resolved (N0 b, c) */
+			if ((stack[i - 1].contains_l &&
+			     ir.isolating_run_level % 2 == 0) ||
+			    (stack[i - 1].contains_r &&
+			     ir.isolating_run_level % 2 != 0)) {
+				pair = BRACKET_PAIR_EMBEDDING;
+			} else if (stack[i - 1].contains_l ||
+			           stack[i - 1].contains_r) {
+				pair = BRACKET_PAIR_CONTEXT;
+			} else {
 				/*
-				 * set the type for both brackets to R (so they
-				 * match the strong type they contain)
+				 * there are no strong types within the
+				 * brackets and we just leave them as is
 				 */
-				bracket_prop = BIDI_PROP_R;
+				pair = BRACKET_PAIR_NONE;
+			}
+			if (pair != BRACKET_PAIR_NONE) {
+				set_state(STATE_BRACKET_PAIR,
+				          (int_least16_t)pair,
+				          &(buf[stack[i - 1].off]));
+				set_state(STATE_BRACKET_PAIR,
+				          BRACKET_PAIR_CLOSING,
+				          &(buf[ir.cur.off]));
+				num_pairs++;
 			}
+
+			/* pop the matching opening */
+			stack_len--;
+			if (stack_len > 0) {
+				stack[stack_len - 1].contains_l |=
+					stack[stack_len].contains_l;
+				stack[stack_len - 1].contains_r |=
+					stack[stack_len].contains_r;
+			}
+		} else if (prop == BIDI_PROP_L && stack_len > 0) {
+			stack[stack_len - 1].contains_l = true;
+		} else if ((prop == BIDI_PROP_R || prop == BIDI_PROP_EN ||
+		            prop == BIDI_PROP_AN) &&
+		           stack_len > 0) {
+			stack[stack_len - 1].contains_r = true;
 		}
 	}
-	if (strong_type_off == SIZE_MAX) {
-		/*
-		 * there are no strong types within the brackets and we just
-		 * leave the brackets as is
-		 */
+
+	if (num_pairs == 0) {
+		/* there is nothing to resolve */
 		return;
 	}
 
-	if (bracket_prop == NUM_BIDI_PROPS) {
-		/*
-		 * We encountered a strong type, but it was opposite
-		 * to the embedding direction.
-		 * Check the previous strong type before the opening
-		 * bracket
-		 */
-		last_strong_or_number_prop =
-			ir_get_last_strong_or_number_prop(start);
-		if (last_strong_or_number_prop == BIDI_PROP_L &&
-		    ir.isolating_run_level % 2 != 0) {
-			/*
-			 * the previous strong type is also opposite
-			 * to the embedding direction, so the context
-			 * was established and we set the brackets
-			 * accordingly.
-			 */
-			bracket_prop = BIDI_PROP_L;
-		} else if ((last_strong_or_number_prop == BIDI_PROP_R ||
-		            last_strong_or_number_prop == BIDI_PROP_EN ||
-		            last_strong_or_number_prop == BIDI_PROP_AN) &&
-		           ir.isolating_run_level % 2 == 0) {
+	/* N0 */
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
+	for (stack_len = 0, last_strong_or_number_prop = ir.sos,
+	    nsm_prop = NUM_BIDI_PROPS;
+	     !ir_advance(&ir);) {
+		pair = (uint_least8_t)get_state(STATE_BRACKET_PAIR,
+		                                ir.buf[ir.cur.off]);
+
+		if (pair == BRACKET_PAIR_EMBEDDING) {
 			/*
-			 * the previous strong type is also opposite
-			 * to the embedding direction, so the context
-			 * was established and we set the brackets
-			 * accordingly.
+			 * set the type for both brackets to the
+			 * embedding direction (so they match the strong
+			 * type they contain)
 			 */
-			bracket_prop = BIDI_PROP_R;
-		} else {
-			/* set brackets to the embedding direction */
 			if (ir.isolating_run_level % 2 == 0) {
 				bracket_prop = BIDI_PROP_L;
 			} else {
 				bracket_prop = BIDI_PROP_R;
 			}
-		}
-	}
-
-	ir_set_current_prop(start, bracket_prop);
-	ir_set_current_prop(end, bracket_prop);
-
-	/*
-	 * any sequence of NSMs after opening or closing brackets get
-	 * the same property as the one we set on the brackets
-	 */
-	for (ir = *start; !ir_advance(&ir) && ir_get_current_preserved_prop(
-						      &ir) == BIDI_PROP_NSM;) {
-		ir_set_current_prop(&ir, bracket_prop);
-	}
-	for (ir = *end; !ir_advance(&ir) &&
-	                ir_get_current_preserved_prop(&ir) == BIDI_PROP_NSM;) {
-		ir_set_current_prop(&ir, bracket_prop);
-	}
-}
-
-static void
-preprocess_bracket_pairs(uint_least32_t *buf, size_t buflen, size_t off,
-                         uint_least8_t paragraph_level)
-{
-	/*
-	 * The N0-rule deals with bracket pairs that shall be determined
-	 * with the rule BD16. This is specified as an algorithm with a
-	 * stack of 63 bracket openings that are used to resolve into a
-	 * separate list of pairs, which is then to be sorted by opening
-	 * position. Thus, even though the bracketing-depth is limited
-	 * by 63, the algorithm, as is, requires dynamic memory
-	 * management.
-	 *
-	 * A naive approach (used by Fribidi) would be to screw the
-	 * stack-approach and simply directly determine the
-	 * corresponding closing bracket offset for a given opening
-	 * bracket, leading to O(n²) time complexity in the worst case
-	 * with a lot of brackets. While many brackets are not common,
-	 * it is still possible to find a middle ground where you obtain
-	 * strongly linear time complexity in most common cases:
-	 *
-	 * Instead of a stack, we use a FIFO data structure which is
-	 * filled with bracket openings in the order of appearance (thus
-	 * yielding an implicit sorting!) at the top. If the
-	 * corresponding closing bracket is encountered, it is added to
-	 * the respective entry, making it ready to "move out" at the
-	 * bottom (i.e. passed to the bracket processing). Due to the
-	 * nature of the specified pair detection algorithm, which only
-	 * cares about the bracket type and nothing else (bidi class,
-	 * level, etc.), we can mix processing and bracket detection.
-	 *
-	 * Obviously, if you, for instance, have one big bracket pair at
-	 * the bottom that has not been closed yet, it will block the
-	 * bracket processing and the FIFO might hit its capacity limit.
-	 * At this point, the blockage is manually resolved using the
-	 * naive quadratic approach.
-	 *
-	 * To remain within the specified standard behaviour, which
-	 * mandates that processing of brackets should stop when the
-	 * bracketing-depth is at 63, we simply check in an "overflow"
-	 * scenario if all 63 elements in the LIFO are unfinished, which
-	 * corresponds with such a bracketing depth.
-	 */
-	enum bidi_property prop;
-
-	struct {
-		bool complete;
-		size_t bracket_class;
-		struct isolate_runner start;
-		struct isolate_runner end;
-	} fifo[63];
-	const struct bracket *bracket_prop, *tmp_bracket_prop;
-	struct isolate_runner ir, tmp_ir;
-	size_t fifo_len = 0, i, blevel, j, k;
-
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
-	while (!ir_advance(&ir)) {
-		prop = ir_get_current_prop(&ir);
-		bracket_prop = ir_get_current_bracket_prop(&ir);
-		if (prop == BIDI_PROP_ON &&
-		    bracket_prop->type == BIDI_BRACKET_OPEN) {
-			if (fifo_len == LEN(fifo)) {
-				/*
-				 * The FIFO is full, check first if it's
-				 * completely blocked (i.e. no finished
-				 * bracket pairs, triggering the standard
-				 * that mandates to abort in such a case
-				 */
-				for (i = 0; i < fifo_len; i++) {
-					if (fifo[i].complete) {
-						break;
-					}
-				}
-				if (i == fifo_len) {
-					/* abort processing */
-					return;
-				}
-
+			resolved[stack_len++] = bracket_prop;
+		} else if (pair == BRACKET_PAIR_CONTEXT) {
+			/*
+			 * We encountered a strong type, but it was
+			 * opposite to the embedding direction.
+			 * Check the previous strong type before the
+			 * opening bracket
+			 */
+			if (last_strong_or_number_prop == BIDI_PROP_L &&
+			    ir.isolating_run_level % 2 != 0) {
 				/*
-				 * by construction, the bottom entry
-				 * in the FIFO is guaranteed to be
-				 * unfinished (given we "consume" all
-				 * finished bottom entries after each
-				 * iteration).
-				 *
-				 * iterate, starting after the opening
-				 * bracket, and find the corresponding
-				 * closing bracket.
-				 *
-				 * if we find none, just drop the FIFO
-				 * entry silently
+				 * the previous strong type is also opposite
+				 * to the embedding direction, so the context
+				 * was established and we set the brackets
+				 * accordingly.
 				 */
-				for (tmp_ir = fifo[0].start, blevel = 0;
-				     !ir_advance(&tmp_ir);) {
-					tmp_bracket_prop =
-						ir_get_current_bracket_prop(
-							&tmp_ir);
-
-					if (tmp_bracket_prop->type ==
-					            BIDI_BRACKET_OPEN &&
-					    tmp_bracket_prop->class ==
-					            bracket_prop->class) {
-						/* we encountered another
-						 * opening bracket of the
-						 * same class */
-						blevel++;
-
-					} else if (tmp_bracket_prop->type ==
-					                   BIDI_BRACKET_CLOSE &&
-					           tmp_bracket_prop->class ==
-					                   bracket_prop
-					                           ->class) {
-						/* we encountered a closing
-						 * bracket of the same class
-						 */
-						if (blevel == 0) {
-							/* this is the
-							 * corresponding
-							 * closing bracket
-							 */
-							fifo[0].complete = true;
-							fifo[0].end = ir;
-						} else {
-							blevel--;
-						}
-					}
-				}
-				if (fifo[0].complete) {
-					/* we found the matching bracket */
-					preprocess_bracket_pair(
-						&(fifo[i].start),
-						&(fifo[i].end));
-				}
-
-				/* shift FIFO one to the left */
-				for (i = 1; i < fifo_len; i++) {
-					fifo[i - 1] = fifo[i];
+				bracket_prop = BIDI_PROP_L;
+			} else if ((last_strong_or_number_prop ==
+			                    BIDI_PROP_R ||
+			            last_strong_or_number_prop ==
+			                    BIDI_PROP_EN ||
+			            last_strong_or_number_prop ==
+			                    BIDI_PROP_AN) &&
+			           ir.isolating_run_level % 2 == 0) {
+				/* see above */
+				bracket_prop = BIDI_PROP_R;
+			} else {
+				/* set brackets to the embedding direction */
+				if (ir.isolating_run_level % 2 == 0) {
+					bracket_prop = BIDI_PROP_L;
+				} else {
+					bracket_prop = BIDI_PROP_R;
 				}
-				fifo_len--;
 			}
-
-			/* add element to the FIFO */
-			fifo_len++;
-			fifo[fifo_len - 1].complete = false;
-			fifo[fifo_len - 1].bracket_class = bracket_prop->class;
-			fifo[fifo_len - 1].start = ir;
-		} else if (prop == BIDI_PROP_ON &&
-		           bracket_prop->type == BIDI_BRACKET_CLOSE) {
+			resolved[stack_len++] = bracket_prop;
+		} else if (pair == BRACKET_PAIR_CLOSING) {
+			/* the closing bracket matches its opening */
+			bracket_prop = resolved[--stack_len];
+		} else if (nsm_prop != NUM_BIDI_PROPS &&
+		           ir_get_current_preserved_prop(&ir) ==
+		                   BIDI_PROP_NSM) {
 			/*
-			 * go backwards in the FIFO, skip finished entries
-			 * and simply ignore (do nothing) the closing
-			 * bracket if we do not match anything
+			 * any sequence of NSMs after opening or closing
+			 * brackets get the same property as the one we
+			 * set on the brackets
 			 */
-			for (i = fifo_len; i > 0; i--) {
-				if (bracket_prop->class ==
-				            fifo[i - 1].bracket_class &&
-				    !fifo[i - 1].complete) {
-					/* we have found a pair */
-					fifo[i - 1].complete = true;
-					fifo[i - 1].end = ir;
-
-					/* remove all uncompleted FIFO elements
-					 * above i - 1 */
-					for (j = i; j < fifo_len;) {
-						if (fifo[j].complete) {
-							j++;
-							continue;
-						}
-
-						/* shift FIFO one to the left */
-						for (k = j + 1; k < fifo_len;
-						     k++) {
-							fifo[k - 1] = fifo[k];
-						}
-						fifo_len--;
-					}
-					break;
-				}
-			}
+			bracket_prop = nsm_prop;
+		} else {
+			bracket_prop = NUM_BIDI_PROPS;
 		}
 
-		/* process all ready bracket pairs from the FIFO bottom */
-		while (fifo_len > 0 && fifo[0].complete) {
-			preprocess_bracket_pair(&(fifo[0].start),
-			                        &(fifo[0].end));
-
-			/* shift FIFO one to the left */
-			for (j = 0; j + 1 < fifo_len; j++) {
-				fifo[j] = fifo[j + 1];
-			}
-			fifo_len--;
+		if (pair != BRACKET_PAIR_NONE) {
+			set_state(STATE_BRACKET_PAIR, BRACKET_PAIR_NONE,
+			          &(ir.buf[ir.cur.off]));
+			nsm_prop = bracket_prop;
+		} else if (bracket_prop == NUM_BIDI_PROPS) {
+			nsm_prop = NUM_BIDI_PROPS;
+		}
+		if (bracket_prop != NUM_BIDI_PROPS) {
+			ir_set_current_prop(&ir, bracket_prop);
 		}
-	}
 
-	/*
-	 * afterwards, we still might have unfinished bracket pairs
-	 * that will remain as such, but the subsequent finished pairs
-	 * also need to be taken into account, so we go through the
-	 * FIFO once more and process all finished pairs
-	 */
-	for (i = 0; i < fifo_len; i++) {
-		if (fifo[i].complete) {
-			preprocess_bracket_pair(&(fifo[i].start),
-			                        &(fifo[i].end));
+		prop = ir_get_current_prop(&ir);
+		if (prop == BIDI_PROP_R || prop == BIDI_PROP_L ||
+		    prop == BIDI_PROP_AL || prop == BIDI_PROP_EN ||
+		    prop == BIDI_PROP_AN) {
+			last_strong_or_number_prop = prop;
 		}
 	}
 }
 
 static size_t
 preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
-                                  size_t off, uint_least8_t paragraph_level)
+                                  const uint_least32_t *links, size_t off,
+                                  uint_least8_t paragraph_level)
 {
-	enum bidi_property sequence_prop, prop;
+	enum bidi_property sequence_prop, last_strong_prop, prop;
 	struct isolate_runner ir, tmp;
 	size_t runsince, sequence_end;
 
 	/* W1 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		if (ir_get_current_prop(&ir) == BIDI_PROP_NSM) {
 			prop = ir_get_previous_prop(&ir);
@@ -705,16 +678,20 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 	}
 
 	/* W2 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
-	while (!ir_advance(&ir)) {
-		if (ir_get_current_prop(&ir) == BIDI_PROP_EN &&
-		    ir_get_last_strong_prop(&ir) == BIDI_PROP_AL) {
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
+	for (last_strong_prop = ir.sos; !ir_advance(&ir);) {
+		prop = ir_get_current_prop(&ir);
+
+		if (prop == BIDI_PROP_EN && last_strong_prop == BIDI_PROP_AL) {
 			ir_set_current_prop(&ir, BIDI_PROP_AN);
+		} else if (prop == BIDI_PROP_R || prop == BIDI_PROP_L ||
+		           prop == BIDI_PROP_AL) {
+			last_strong_prop = prop;
 		}
 	}
 
 	/* W3 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		if (ir_get_current_prop(&ir) == BIDI_PROP_AL) {
 			ir_set_current_prop(&ir, BIDI_PROP_R);
@@ -722,7 +699,7 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 	}
 
 	/* W4 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		if (ir_get_previous_prop(&ir) == BIDI_PROP_EN &&
 		    (ir_get_current_prop(&ir) == BIDI_PROP_ES ||
@@ -740,7 +717,7 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 
 	/* W5 */
 	runsince = SIZE_MAX;
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		if (ir_get_current_prop(&ir) == BIDI_PROP_ET) {
 			if (runsince == SIZE_MAX) {
@@ -750,15 +727,16 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 		} else if (ir_get_current_prop(&ir) == BIDI_PROP_EN) {
 			/* set the preceding sequence */
 			if (runsince != SIZE_MAX) {
-				ir_init(buf, buflen, runsince, paragraph_level,
-				        (runsince > off), &tmp);
+				ir_init(buf, buflen, links, runsince,
+				        paragraph_level, (runsince > off),
+				        &tmp);
 				while (!ir_advance(&tmp) &&
 				       tmp.cur.off < ir.cur.off) {
 					ir_set_current_prop(&tmp, BIDI_PROP_EN);
 				}
 				runsince = SIZE_MAX;
 			} else {
-				ir_init(buf, buflen, ir.cur.off,
+				ir_init(buf, buflen, links, ir.cur.off,
 				        paragraph_level, (ir.cur.off > off),
 				        &tmp);
 				ir_advance(&tmp);
@@ -777,7 +755,7 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 	}
 
 	/* W6 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		prop = ir_get_current_prop(&ir);
 
@@ -788,21 +766,25 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 	}
 
 	/* W7 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
-	while (!ir_advance(&ir)) {
-		if (ir_get_current_prop(&ir) == BIDI_PROP_EN &&
-		    ir_get_last_strong_prop(&ir) == BIDI_PROP_L) {
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
+	for (last_strong_prop = ir.sos; !ir_advance(&ir);) {
+		prop = ir_get_current_prop(&ir);
+
+		if (prop == BIDI_PROP_EN && last_strong_prop == BIDI_PROP_L) {
 			ir_set_current_prop(&ir, BIDI_PROP_L);
+		} else if (prop == BIDI_PROP_R || prop == BIDI_PROP_L ||
+		           prop == BIDI_PROP_AL) {
+			last_strong_prop = prop;
 		}
 	}
 
 	/* N0 */
-	preprocess_bracket_pairs(buf, buflen, off, paragraph_level);
+	preprocess_bracket_pairs(buf, buflen, links, off, paragraph_level);
 
 	/* N1 */
 	sequence_end = SIZE_MAX;
 	sequence_prop = NUM_BIDI_PROPS;
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		if (sequence_end == SIZE_MAX) {
 			prop = ir_get_current_prop(&ir);
@@ -816,7 +798,7 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 
 				/* scan ahead to the end of the NI-sequence
 				 */
-				ir_init(buf, buflen, ir.cur.off,
+				ir_init(buf, buflen, links, ir.cur.off,
 				        paragraph_level, (ir.cur.off > off),
 				        &tmp);
 				while (!ir_advance(&tmp)) {
@@ -856,13 +838,23 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 				                    BIDI_PROP_AN)) {
 					sequence_end = tmp.cur.off;
 					sequence_prop = BIDI_PROP_R;
+				} else {
+					/*
+					 * the NI-sequence is left as is and
+					 * we skip it, as the check fails for
+					 * all of its later characters
+					 */
+					sequence_end = tmp.cur.off;
 				}
 			}
 		}
 
 		if (sequence_end != SIZE_MAX) {
 			if (ir.cur.off <= sequence_end) {
-				ir_set_current_prop(&ir, sequence_prop);
+				if (sequence_prop != NUM_BIDI_PROPS) {
+					ir_set_current_prop(&ir,
+					                    sequence_prop);
+				}
 			} else {
 				/* end of sequence, reset */
 				sequence_end = SIZE_MAX;
@@ -872,7 +864,7 @@ preprocess_isolating_run_sequence(uint_least32_t *buf, size_t buflen,
 	}
 
 	/* N2 */
-	ir_init(buf, buflen, off, paragraph_level, false, &ir);
+	ir_init(buf, buflen, links, off, paragraph_level, false, &ir);
 	while (!ir_advance(&ir)) {
 		prop = ir_get_current_prop(&ir);
 
@@ -898,8 +890,7 @@ static uint_least8_t
 get_isolated_paragraph_level(const uint_least32_t *state, size_t statelen)
 {
 	enum bidi_property prop;
-	int_least8_t isolate_level;
-	size_t stateoff;
+	size_t stateoff, isolate_level;
 
 	/* determine paragraph level (rules P1-P3) and terminate on PDI */
 	for (stateoff = 0, isolate_level = 0; stateoff < statelen; stateoff++) {
@@ -914,9 +905,8 @@ get_isolated_paragraph_level(const uint_least32_t *state, size_t statelen)
 		}
 
 		/* BD8/BD9 */
-		if ((prop == BIDI_PROP_LRI || prop == BIDI_PROP_RLI ||
-		     prop == BIDI_PROP_FSI) &&
-		    isolate_level < MAX_DEPTH) {
+		if (prop == BIDI_PROP_LRI || prop == BIDI_PROP_RLI ||
+		    prop == BIDI_PROP_FSI) {
 			/* we hit an isolate initiator, increment counter */
 			isolate_level++;
 		} else if (prop == BIDI_PROP_PDI && isolate_level > 0) {
@@ -950,59 +940,63 @@ get_bidi_property(uint_least32_t cp)
 	}
 }
 
-static uint_least8_t
-get_paragraph_level(enum grapheme_bidirectional_direction override,
-                    const HERODOTUS_READER *r)
+static bool
+link_isolates(const uint_least32_t *buf, size_t buflen, uint_least32_t *links)
 {
-	HERODOTUS_READER tmp;
 	enum bidi_property prop;
-	int_least8_t isolate_level;
-	uint_least32_t cp;
+	uint_least32_t bufoff, top, prev;
 
-	/* check overrides first according to rule HL1 */
-	if (override == GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR) {
-		return 0;
-	} else if (override == GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL) {
-		return 1;
+	/*
+	 * ir_advance() skips the isolate behind an isolate initiator
+	 * by counting the nested initiators and PDIs (BD8, BD9), which
+	 * takes time proportional to the length of the isolate and is
+	 * repeated in each rule pass for each isolating run sequence
+	 * enclosing it. If the caller provided a scratch buffer for the
+	 * links, we instead match the initiators with their PDIs once
+	 * per paragraph and store the offset to the matching PDI, or
+	 * UINT_LEAST32_MAX if there is none, at the offset of the
+	 * initiator. The stack of open initiators is kept in the same
+	 * buffer, where each open initiator stores the offset of the
+	 * one enclosing it until it is matched. The offsets must fit
+	 * into the links, otherwise we leave the isolates to the
+	 * counting.
+	 */
+	if (links == NULL || buflen >= UINT_LEAST32_MAX) {
+		return false;
 	}
 
-	/* copy reader into temporary reader */
-	herodotus_reader_copy(r, &tmp);
-
-	/* determine paragraph level (rules P1-P3) */
-	for (isolate_level = 0; herodotus_read_codepoint(&tmp, true, &cp) ==
-	                        HERODOTUS_STATUS_SUCCESS;) {
-		prop = get_bidi_property(cp);
-
-		/* BD8/BD9 */
-		if ((prop == BIDI_PROP_LRI || prop == BIDI_PROP_RLI ||
-		     prop == BIDI_PROP_FSI) &&
-		    isolate_level < MAX_DEPTH) {
-			/* we hit an isolate initiator, increment counter */
-			isolate_level++;
-		} else if (prop == BIDI_PROP_PDI && isolate_level > 0) {
-			isolate_level--;
-		}
-
-		/* P2 */
-		if (isolate_level > 0) {
+	for (bufoff = 0, top = UINT_LEAST32_MAX; bufoff < buflen; bufoff++) {
+		if (get_state(STATE_LEVEL, buf[bufoff]) == -1) {
+			/* ignored character */
 			continue;
 		}
+		prop = (uint_least8_t)get_state(STATE_PROP, buf[bufoff]);
 
-		/* P3 */
-		if (prop == BIDI_PROP_L) {
-			return 0;
-		} else if (prop == BIDI_PROP_AL || prop == BIDI_PROP_R) {
-			return 1;
+		if (prop == BIDI_PROP_LRI || prop == BIDI_PROP_RLI ||
+		    prop == BIDI_PROP_FSI) {
+			/* push */
+			links[bufoff] = top;
+			top = bufoff;
+		} else if (prop == BIDI_PROP_PDI && top != UINT_LEAST32_MAX) {
+			/* pop and link */
+			prev = links[top];
+			links[top] = bufoff - top;
+			top = prev;
 		}
 	}
 
-	return 0;
+	/* the remaining initiators have no matching PDI */
+	for (; top != UINT_LEAST32_MAX; top = prev) {
+		prev = links[top];
+		links[top] = UINT_LEAST32_MAX;
+	}
+
+	return true;
 }
 
 static void
 preprocess_paragraph(uint_least8_t paragraph_level, uint_least32_t *buf,
-                     size_t buflen)
+                     size_t buflen, uint_least32_t *links)
 {
 	enum bidi_property prop;
 	int_least8_t level;
@@ -1268,11 +1262,14 @@ again:
 	}
 
 	/* X10 (W1-W7, N0-N2) */
+	if (!link_isolates(buf, buflen, links)) {
+		links = NULL;
+	}
 	for (bufoff = 0; bufoff < buflen; bufoff++) {
 		if (get_state(STATE_VISITED, buf[bufoff]) == 0 &&
 		    get_state(STATE_LEVEL, buf[bufoff]) != -1) {
 			bufoff += preprocess_isolating_run_sequence(
-				buf, buflen, bufoff, paragraph_level);
+				buf, buflen, links, bufoff, paragraph_level);
 		}
 	}
 
@@ -1374,93 +1371,285 @@ get_bidi_bracket_off(uint_least32_t cp)
 	}
 }
 
-static size_t
-preprocess(HERODOTUS_READER *r, enum grapheme_bidirectional_direction override,
-           uint_least32_t *buf, size_t buflen,
-           enum grapheme_bidirectional_direction *resolved)
+static inline bool
+is_trivial_property(uint_least8_t prop)
+{
+	/*
+	 * Without right-to-left characters, Arabic numbers and
+	 * explicit directional formatting characters, all characters
+	 * of a left-to-right paragraph end up at level 0, apart from
+	 * the ones removed by rule X9, and European numbers are
+	 * resolved to L by rule W7
+	 */
+	return !((UINT32_C(1) << prop) &
+	         ((UINT32_C(1) << BIDI_PROP_R) | (UINT32_C(1) << BIDI_PROP_AL) |
+	          (UINT32_C(1) << BIDI_PROP_AN) |
+	          (UINT32_C(1) << BIDI_PROP_LRE) |
+	          (UINT32_C(1) << BIDI_PROP_LRO) |
+	          (UINT32_C(1) << BIDI_PROP_RLE) |
+	          (UINT32_C(1) << BIDI_PROP_RLO) |
+	          (UINT32_C(1) << BIDI_PROP_PDF) |
+	          (UINT32_C(1) << BIDI_PROP_LRI) |
+	          (UINT32_C(1) << BIDI_PROP_RLI) |
+	          (UINT32_C(1) << BIDI_PROP_FSI) |
+	          (UINT32_C(1) << BIDI_PROP_PDI)));
+}
+
+static bool
+is_trivial(HERODOTUS_READER *r)
 {
-	HERODOTUS_READER tmp;
-	size_t bufoff, bufsize, paragraph_len;
 	uint_least32_t cp;
-	uint_least8_t paragraph_level;
 
-	/* determine length and level of the paragraph */
-	herodotus_reader_copy(r, &tmp);
-	for (; herodotus_read_codepoint(&tmp, true, &cp) ==
-	       HERODOTUS_STATUS_SUCCESS;) {
-		/* break on paragraph separator */
-		if (get_bidi_property(cp) == BIDI_PROP_B) {
-			break;
+	/*
+	 * ASCII has no characters that make a paragraph non-trivial,
+	 * so we skip runs of it without looking up their properties.
+	 */
+	for (;;) {
+		herodotus_reader_skip_ascii(r);
+		if (herodotus_read_codepoint(r, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			return true;
+		}
+		if (!is_trivial_property(get_bidi_property(cp))) {
+			return false;
 		}
 	}
-	paragraph_len = herodotus_reader_number_read(&tmp);
-	paragraph_level = get_paragraph_level(override, r);
+}
 
-	if (resolved != NULL) {
-		/* store resolved paragraph level in output variable */
-		/* TODO use enum-type */
-		*resolved = (paragraph_level == 0) ?
-		                    GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR :
-		                    GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL;
-	}
+bool
+grapheme_bidirectional_is_trivial(const uint_least32_t *src, size_t srclen)
+{
+	HERODOTUS_READER r;
 
-	if (buf == NULL) {
-		/* see below for return value reasoning */
-		return paragraph_len;
-	}
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
+
+	return is_trivial(&r);
+}
+
+bool
+grapheme_bidirectional_is_trivial_utf8(const char *src, size_t srclen)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+
+	return is_trivial(&r);
+}
+
+static uint_least32_t
+get_initial_state(uint_least8_t prop, uint_least8_t bracket_off,
+                  size_t cplen)
+{
+	uint_least32_t state = 0;
 
 	/*
-	 * the first step is to determine the bidirectional properties
-	 * and store them in the buffer
+	 * The characters removed by rule X9 are already marked as such,
+	 * as they are not touched for trivial paragraphs
 	 */
-	for (bufoff = 0;
-	     bufoff < paragraph_len &&
-	     herodotus_read_codepoint(r, true, &cp) == HERODOTUS_STATUS_SUCCESS;
-	     bufoff++) {
-		if (bufoff < buflen) {
+	set_state(STATE_PROP, prop, &state);
+	set_state(STATE_BRACKET_OFF, bracket_off, &state);
+	set_state(STATE_LEVEL, (prop == BIDI_PROP_BN) ? -1 : 0, &state);
+	set_state(STATE_PARAGRAPH_LEVEL, 0, &state);
+	set_state(STATE_VISITED, 0, &state);
+	set_state(STATE_PRESERVED_PROP, prop, &state);
+	set_state(STATE_SOURCE_LEN, (int_least16_t)cplen, &state);
+	set_state(STATE_BRACKET_PAIR, BRACKET_PAIR_NONE, &state);
+
+	return state;
+}
+
+/*
+ * The initial states of the ASCII characters, which are filled on first
+ * use by get_initial_state(), just like for any other character
+ */
+static uint_least32_t ascii_state[0x80];
+static bool ascii_state_filled = false;
+
+static size_t
+preprocess_ascii(HERODOTUS_READER *r, uint_least32_t *buf, size_t buflen,
+                 int_least8_t *paragraph_level, size_t isolate_level)
+{
+	const void *src;
+	size_t off, len, i;
+	uint_least32_t state;
+	bool nul_terminated, utf8;
+
+	/*
+	 * We skip the run of ASCII characters at the reader position
+	 * and copy their precomputed states into the buffer, stopping
+	 * before a paragraph separator, which is left to the caller
+	 */
+	if (!ascii_state_filled) {
+		for (i = 0; i < LEN(ascii_state); i++) {
+			ascii_state[i] = get_initial_state(
+				get_bidi_property((uint_least32_t)i),
+				get_bidi_bracket_off((uint_least32_t)i), 1);
+		}
+		ascii_state_filled = true;
+	}
+	utf8 = herodotus_reader_window(r, HERODOTUS_TYPE_UTF8, &src,
+	                               &nul_terminated) > 0;
+	if (!utf8 && herodotus_reader_window(r, HERODOTUS_TYPE_CODEPOINT,
+	                                     &src, &nul_terminated) == 0) {
+		return 0;
+	}
+	off = herodotus_reader_number_read(r);
+	len = herodotus_reader_skip_ascii(r);
+
+	for (i = 0; i < len; i++) {
+		state = ascii_state[utf8 ? ((const unsigned char *)src)[i] :
+		                           ((const uint_least32_t *)src)[i]];
+		if (get_state(STATE_PROP, state) == BIDI_PROP_B) {
+			herodotus_reader_seek(r, off + i);
+			break;
+		}
+		if (buf != NULL && i < buflen) {
+			buf[i] = state;
+		}
+		if (*paragraph_level == -1 && isolate_level == 0 &&
+		    get_state(STATE_PROP, state) == BIDI_PROP_L) {
+			/* first strong character outside isolates (P2) */
+			*paragraph_level = 0;
+		}
+	}
+
+	return i;
+}
+
+static size_t
+preprocess(HERODOTUS_READER *r, enum grapheme_bidirectional_direction override,
+           uint_least32_t *buf, size_t buflen, uint_least32_t *links,
+           enum grapheme_bidirectional_direction *resolved)
+{
+	HERODOTUS_READER tmp;
+	size_t bufoff, paragraph_len, srcoff, cplen, isolate_level;
+	uint_least32_t cp;
+	uint_least8_t prop;
+	int_least8_t paragraph_level;
+	bool trivial;
+
+	/*
+	 * determine the length of the paragraph in codepoints, its
+	 * level and whether it is trivial, and at the same time store
+	 * the bidirectional properties in the buffer
+	 */
+	herodotus_reader_copy(r, &tmp);
+	paragraph_len = 0;
+	srcoff = 0;
+	trivial = true;
+	paragraph_level = -1;
+	isolate_level = 0;
+	for (;;) {
+		if (herodotus_read_codepoint(&tmp, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+		bufoff = paragraph_len++;
+		cplen = herodotus_reader_number_read(&tmp) - srcoff;
+		srcoff += cplen;
+		prop = get_bidi_property(cp);
+
+		if (buf != NULL && bufoff < buflen) {
 			/*
 			 * actually only do something when we have
 			 * space in the level-buffer. We continue
 			 * the iteration to be able to give a good
-			 * return value
+			 * return value.
 			 */
-			set_state(STATE_PROP,
-			          (uint_least8_t)get_bidi_property(cp),
-			          &(buf[bufoff]));
-			set_state(STATE_BRACKET_OFF, get_bidi_bracket_off(cp),
-			          &(buf[bufoff]));
-			set_state(STATE_LEVEL, 0, &(buf[bufoff]));
-			set_state(STATE_PARAGRAPH_LEVEL, 0, &(buf[bufoff]));
-			set_state(STATE_VISITED, 0, &(buf[bufoff]));
-			set_state(STATE_PRESERVED_PROP,
-			          (uint_least8_t)get_bidi_property(cp),
-			          &(buf[bufoff]));
-		}
-	}
-	bufsize = herodotus_reader_number_read(r);
-
-	for (bufoff = 0; bufoff < bufsize; bufoff++) {
-		if (get_state(STATE_PROP, buf[bufoff]) != BIDI_PROP_B &&
-		    bufoff != bufsize - 1) {
-			continue;
+			buf[bufoff] = get_initial_state(
+				prop, get_bidi_bracket_off(cp), cplen);
 		}
 
+		if (!is_trivial_property(prop)) {
+			trivial = false;
+		}
+
+		/* determine paragraph level (rules P2, P3) */
+		if (paragraph_level == -1) {
+			/* BD8/BD9 */
+			if (prop == BIDI_PROP_LRI || prop == BIDI_PROP_RLI ||
+			    prop == BIDI_PROP_FSI) {
+				/* we hit an isolate initiator */
+				isolate_level++;
+			} else if (prop == BIDI_PROP_PDI &&
+			           isolate_level > 0) {
+				isolate_level--;
+			} else if (isolate_level == 0) {
+				/* first strong character outside isolates */
+				if (prop == BIDI_PROP_L) {
+					paragraph_level = 0;
+				} else if (prop == BIDI_PROP_AL ||
+				           prop == BIDI_PROP_R) {
+					paragraph_level = 1;
+				}
+			}
+		}
+
+		/* break on paragraph separator (P1) */
+		if (prop == BIDI_PROP_B) {
+			break;
+		}
+
+		if (cp < 0x80) {
+			/*
+			 * copy the states of the rest of the ASCII run,
+			 * which is trivial and contains no isolate
+			 * initiators
+			 */
+			cplen = preprocess_ascii(
+				&tmp,
+				(buf != NULL && paragraph_len < buflen) ?
+					buf + paragraph_len :
+					NULL,
+				(paragraph_len < buflen) ?
+					buflen - paragraph_len :
+					0,
+				&paragraph_level, isolate_level);
+			paragraph_len += cplen;
+			srcoff += cplen;
+		}
+	}
+
+	/* advance the reader past the paragraph */
+	herodotus_reader_seek(r, herodotus_reader_number_read(r) +
+	                                 herodotus_reader_number_read(&tmp));
+
+	/* check overrides according to rule HL1 */
+	if (override == GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR) {
+		paragraph_level = 0;
+	} else if (override == GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL) {
+		paragraph_level = 1;
+	} else if (paragraph_level == -1) {
+		/* there is no strong character in the paragraph */
+		paragraph_level = 0;
+	}
+
+	if (resolved != NULL) {
+		/* store resolved paragraph level in output variable */
+		/* TODO use enum-type */
+		*resolved = (paragraph_level == 0) ?
+		                    GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR :
+		                    GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL;
+	}
+
+	if (buf != NULL && paragraph_len > 0 &&
+	    !(trivial && paragraph_level == 0)) {
 		/*
-		 * we either encountered a paragraph terminator or this
-		 * is the last character in the string.
 		 * Call the paragraph handler on the paragraph, including
 		 * the terminating character or last character of the
-		 * string respectively
+		 * string respectively. A trivial left-to-right paragraph
+		 * is already completely resolved, as all its levels are
+		 * 0 apart from the removed characters.
 		 */
-		preprocess_paragraph(paragraph_level, buf, bufoff + 1);
-		break;
+		preprocess_paragraph((uint_least8_t)paragraph_level, buf,
+		                     MIN(paragraph_len, buflen), links);
 	}
 
 	/*
-	 * we return the number of total bytes read, as the function
+	 * we return the number of total codepoints read, as the function
 	 * should indicate if the given level-buffer is too small
 	 */
-	return herodotus_reader_number_read(r);
+	return paragraph_len;
 }
 
 size_t
@@ -1473,7 +1662,261 @@ grapheme_bidirectional_preprocess_paragraph(
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
 
-	return preprocess(&r, override, dest, destlen, resolved);
+	return preprocess(&r, override, dest, destlen, NULL, resolved);
+}
+
+size_t
+grapheme_bidirectional_preprocess_paragraph_utf8(
+	const char *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least32_t *dest,
+	size_t destlen, enum grapheme_bidirectional_direction *resolved)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+
+	return preprocess(&r, override, dest, destlen, NULL, resolved);
+}
+
+size_t
+grapheme_bidirectional_preprocess_paragraph_links(
+	const uint_least32_t *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least32_t *dest,
+	size_t destlen, uint_least32_t *links,
+	enum grapheme_bidirectional_direction *resolved)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
+
+	return preprocess(&r, override, dest, destlen, links, resolved);
+}
+
+size_t
+grapheme_bidirectional_preprocess_paragraph_links_utf8(
+	const char *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least32_t *dest,
+	size_t destlen, uint_least32_t *links,
+	enum grapheme_bidirectional_direction *resolved)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+
+	return preprocess(&r, override, dest, destlen, links, resolved);
+}
+
+static void
+compact_states(const uint_least32_t *data, size_t datalen,
+               uint_least16_t *compact, size_t compactlen)
+{
+	enum state_type t;
+	size_t i, j;
+	uint_least32_t raw;
+
+	for (i = 0; i < MIN(datalen, compactlen); i++) {
+		for (j = 0, compact[i] = 0; j < LEN(compact_state_lut); j++) {
+			t = compact_state_lut[j].type;
+			raw = (data[i] & state_lut[t].filter_mask) >>
+			      state_lut[t].mask_shift;
+			compact[i] |= (uint_least16_t)(
+				(raw << compact_state_lut[j].mask_shift) &
+				compact_state_lut[j].filter_mask);
+		}
+	}
+}
+
+static size_t
+preprocess_document(HERODOTUS_READER *r,
+                    enum grapheme_bidirectional_direction override,
+                    uint_least32_t *buf, size_t buflen,
+                    uint_least16_t *compact, size_t compactlen,
+                    size_t *maxparlen,
+                    struct grapheme_bidirectional_paragraph *par,
+                    size_t parlen, size_t *parcount)
+{
+	enum grapheme_bidirectional_direction resolved;
+	size_t off, len, count, maxlen;
+
+	/*
+	 * process the paragraphs one after the other, each in a single
+	 * pass over its input, and store the states consecutively. If
+	 * compact states are requested, each paragraph is fully
+	 * resolved at the beginning of the buffer and then compacted
+	 * into the destination, until we hit the first paragraph that
+	 * does not fit into the buffer, from which on we only count.
+	 * The buffer thus has to hold the longest paragraph in addition
+	 * to the compact states, which is more than the plain states
+	 * take for a document consisting of a single paragraph.
+	 */
+	for (off = 0, count = 0, maxlen = 0;; off += len, count++) {
+		if (compact == NULL) {
+			len = preprocess(r, override,
+			                 (buf == NULL) ? NULL :
+			                                 buf + MIN(off, buflen),
+			                 buflen - MIN(off, buflen), NULL,
+			                 &resolved);
+		} else {
+			len = preprocess(r, override,
+			                 (maxlen > buflen) ? NULL : buf,
+			                 buflen, NULL, &resolved);
+			if (len <= buflen && maxlen <= buflen) {
+				compact_states(buf, len,
+				               compact + MIN(off, compactlen),
+				               compactlen -
+				                       MIN(off, compactlen));
+			}
+		}
+		maxlen = MAX(maxlen, len);
+		if (len == 0) {
+			/* we reached the end of the input */
+			break;
+		}
+
+		if (par != NULL && count < parlen) {
+			par[count].off = off;
+			par[count].len = len;
+			par[count].direction = resolved;
+		}
+	}
+
+	if (parcount != NULL) {
+		*parcount = count;
+	}
+	if (maxparlen != NULL) {
+		*maxparlen = maxlen;
+	}
+
+	return off;
+}
+
+size_t
+grapheme_bidirectional_preprocess_document(
+	const uint_least32_t *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least32_t *dest,
+	size_t destlen, struct grapheme_bidirectional_paragraph *par,
+	size_t parlen, size_t *parcount)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
+
+	return preprocess_document(&r, override, dest, destlen, NULL, 0, NULL,
+	                           par, parlen, parcount);
+}
+
+size_t
+grapheme_bidirectional_preprocess_document_utf8(
+	const char *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least32_t *dest,
+	size_t destlen, struct grapheme_bidirectional_paragraph *par,
+	size_t parlen, size_t *parcount)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+
+	return preprocess_document(&r, override, dest, destlen, NULL, 0, NULL,
+	                           par, parlen, parcount);
+}
+
+size_t
+grapheme_bidirectional_preprocess_document_compact(
+	const uint_least32_t *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least16_t *dest,
+	size_t destlen, uint_least32_t *buf, size_t buflen, size_t *maxparlen,
+	struct grapheme_bidirectional_paragraph *par, size_t parlen,
+	size_t *parcount)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
+
+	return preprocess_document(&r, override, buf, buflen, dest, destlen,
+	                           maxparlen, par, parlen, parcount);
+}
+
+size_t
+grapheme_bidirectional_preprocess_document_compact_utf8(
+	const char *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, uint_least16_t *dest,
+	size_t destlen, uint_least32_t *buf, size_t buflen, size_t *maxparlen,
+	struct grapheme_bidirectional_paragraph *par, size_t parlen,
+	size_t *parcount)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+
+	return preprocess_document(&r, override, buf, buflen, dest, destlen,
+	                           maxparlen, par, parlen, parcount);
+}
+
+size_t
+grapheme_bidirectional_expand_states(const uint_least16_t *compact,
+                                     size_t compactlen, uint_least32_t *dest,
+                                     size_t destlen)
+{
+	enum state_type t;
+	size_t i, j;
+	uint_least32_t raw;
+
+	/*
+	 * restore the states needed by the line functions, where the
+	 * states that were dropped are all zero
+	 */
+	for (i = 0; i < MIN(compactlen, destlen); i++) {
+		for (j = 0, dest[i] = 0; j < LEN(compact_state_lut); j++) {
+			t = compact_state_lut[j].type;
+			raw = compact[i] & compact_state_lut[j].filter_mask;
+			raw >>= compact_state_lut[j].mask_shift;
+			dest[i] |= (raw << state_lut[t].mask_shift) &
+			           state_lut[t].filter_mask;
+		}
+	}
+
+	return compactlen;
+}
+
+/*
+ * The source lengths are not stored cumulatively, so both of the
+ * following lookups scan the states from the beginning and take time
+ * proportional to the offset. Mapping every offset of a paragraph
+ * this way takes quadratic time. The offsets are relative to the
+ * given states though, so a caller mapping offsets in increasing
+ * order can instead pass the states from the last mapped codepoint
+ * onward and add up the results, which takes linear time in total.
+ */
+size_t
+grapheme_bidirectional_get_byte_offset(const uint_least32_t *data,
+                                       size_t datalen, size_t off)
+{
+	size_t i, byteoff;
+
+	/* sum up the source lengths of the codepoints before off */
+	for (i = 0, byteoff = 0; i < MIN(off, datalen); i++) {
+		byteoff += (size_t)get_state(STATE_SOURCE_LEN, data[i]);
+	}
+
+	return byteoff;
+}
+
+size_t
+grapheme_bidirectional_get_codepoint_offset(const uint_least32_t *data,
+                                            size_t datalen, size_t byteoff)
+{
+	size_t i, len;
+
+	/* skip the codepoints that end at or before byteoff */
+	for (i = 0; i < datalen; i++) {
+		len = (size_t)get_state(STATE_SOURCE_LEN, data[i]);
+		if (len > byteoff) {
+			break;
+		}
+		byteoff -= len;
+	}
+
+	return i;
 }
 
 static inline size_t
@@ -1586,19 +2029,188 @@ get_mirror_offset(uint_least32_t cp)
 	}
 }
 
-size_t
-grapheme_bidirectional_reorder_line(const uint_least32_t *line,
-                                    const uint_least32_t *linedata,
-                                    size_t linelen, uint_least32_t *output,
-                                    size_t outputsize)
+/*
+ * the reversal of the output elements first..last-1, defined for each
+ * type of output the sequence stack reorders, such that the elements
+ * are swapped as a whole
+ */
+#define DEFINE_REVERSE(name, type)                                \
+	static void name(void *output, size_t first, size_t last) \
+	{                                                         \
+		type tmp, *out = output;                          \
+                                                                  \
+		for (; first + 1 < last; first++, last--) {       \
+			tmp = out[first];                         \
+			out[first] = out[last - 1];               \
+			out[last - 1] = tmp;                      \
+		}                                                 \
+	}
+
+DEFINE_REVERSE(reverse_output, uint_least32_t)
+DEFINE_REVERSE(reverse_output_utf8, char)
+DEFINE_REVERSE(reverse_index, size_t)
+DEFINE_REVERSE(reverse_run, struct grapheme_bidirectional_run)
+
+struct sequence_stack {
+	struct {
+		int_least8_t level;
+		size_t off;
+	} sequence[MAX_DEPTH + 2];
+	size_t depth;
+	int_least8_t min_odd_level;
+};
+
+static void
+sequence_stack_push(struct sequence_stack *s, int_least8_t level, size_t off,
+                    void (*reverse)(void *, size_t, size_t), void *output)
+{
+	size_t first;
+	int_least8_t lower;
+
+	/*
+	 * Rule L2 reverses, from the highest level down to the lowest
+	 * odd level, each maximal sequence of characters at that level
+	 * or higher. These sequences are nested into each other, and
+	 * we determine them in a single pass with a stack of the
+	 * currently open sequences, which have strictly increasing
+	 * levels. The characters are pushed in logical order with
+	 * their output offset, and a level of -1 at the end of the
+	 * line closes all sequences.
+	 *
+	 * When a sequence at level k ends and is enclosed by a
+	 * sequence at level j, it is reversed once for each level in
+	 * j+1..k that is not below the lowest odd level, and thus only
+	 * needs to be reversed if this count is odd.
+	 */
+	for (first = off;
+	     s->depth > 0 && s->sequence[s->depth - 1].level > level;) {
+		s->depth--;
+		first = s->sequence[s->depth].off;
+		lower = level;
+		if (s->depth > 0 && s->sequence[s->depth - 1].level > lower) {
+			lower = s->sequence[s->depth - 1].level;
+		}
+		if (lower < s->min_odd_level - 1) {
+			lower = s->min_odd_level - 1;
+		}
+		if (s->sequence[s->depth].level > lower &&
+		    (s->sequence[s->depth].level - lower) % 2 == 1) {
+			reverse(output, first, off);
+		}
+	}
+
+	/* open a sequence beginning at the closed sequences */
+	if (level >= 0 &&
+	    (s->depth == 0 || s->sequence[s->depth - 1].level < level)) {
+		s->sequence[s->depth].level = level;
+		s->sequence[s->depth].off = first;
+		s->depth++;
+	}
+}
+
+static inline bool
+is_reversed_level(int_least8_t level, int_least8_t min_odd_level)
+{
+	/*
+	 * rule L2 reverses a character at the given level once for
+	 * each level from its own down to the lowest odd level
+	 */
+	return level >= min_odd_level && (level - min_odd_level) % 2 == 0;
+}
+
+static void
+mark_grapheme_clusters(const uint_least32_t *line,
+                       const uint_least32_t *linedata, size_t linelen,
+                       uint_least32_t *output)
+{
+	size_t i, j, len, first, last, off;
+
+	/*
+	 * we use a special trick here: The first 21 bits of the output
+	 * are filled with the codepoint, the next 8 bits are used for
+	 * the level, so we can use the 30th bit to mark the first and
+	 * the 31st bit to mark the last character of each grapheme
+	 * cluster. The removed characters are not part of the output,
+	 * such that we mark the first and last remaining ones.
+	 */
+	for (i = 0, off = 0; i < linelen; i += len) {
+		len = grapheme_next_character_break(line + i, linelen - i);
+
+		for (j = i, first = last = SIZE_MAX; j < i + len; j++) {
+			if ((int_least8_t)get_state(STATE_LEVEL,
+			                            linedata[j]) != -1) {
+				if (first == SIZE_MAX) {
+					first = off;
+				}
+				last = off++;
+			}
+		}
+
+		if (first != SIZE_MAX) {
+			output[first] |= UINT32_C(1) << 29;
+			output[last] |= UINT32_C(1) << 30;
+		}
+	}
+}
+
+static void
+reinvert_grapheme_clusters(uint_least32_t *output, size_t outputlen,
+                           int_least8_t min_odd_level)
+{
+	size_t i, j;
+	int_least8_t level;
+
+	/*
+	 * A reversed grapheme cluster begins with its last and ends
+	 * with its first character, and as its characters are
+	 * consecutive within a level run, they are also consecutive
+	 * after the reversal. We reinvert each cluster whose
+	 * characters all have the same level into the logical order.
+	 */
+	for (i = 0; i < outputlen; i++) {
+		if ((output[i] & UINT32_C(0x60000000)) !=
+		    (UINT32_C(1) << 30)) {
+			/* not the last character of a longer cluster */
+			continue;
+		}
+
+		level = get_level_uint32(output, i);
+		if (!is_reversed_level(level, min_odd_level)) {
+			continue;
+		}
+
+		/* find the first character of the cluster */
+		for (j = i + 1; j < outputlen &&
+		                get_level_uint32(output, j) == level &&
+		                !(output[j] & UINT32_C(0x60000000));
+		     j++) {
+			;
+		}
+		if (j < outputlen && get_level_uint32(output, j) == level &&
+		    (output[j] & UINT32_C(0x60000000)) ==
+		            (UINT32_C(1) << 29)) {
+			reverse_output(output, i, j + 1);
+			i = j;
+		}
+	}
+}
+
+static size_t
+reorder_line(const uint_least32_t *line, const uint_least32_t *linedata,
+             size_t linelen, uint_least32_t *output, size_t outputsize,
+             bool reinvert_clusters)
 {
-	size_t i, outputlen, first, last, j, k, l /*, laststart*/;
-	int_least8_t level, min_odd_level = MAX_DEPTH + 2, max_level = 0;
-	uint_least32_t tmp;
+	struct sequence_stack stack;
+	size_t i, outputlen;
+	int_least8_t level, max_level = 0;
 
 	/* write output characters (and apply possible mirroring) */
 	for (i = 0, outputlen = 0; i < linelen; i++) {
-		if (get_state(STATE_LEVEL, linedata[i]) != -1) {
+		level = (int_least8_t)get_state(STATE_LEVEL, linedata[i]);
+		if (level > max_level) {
+			max_level = level;
+		}
+		if (level != -1) {
 			if (outputlen < outputsize) {
 				output[outputlen] =
 					(uint_least32_t)((int_least32_t)
@@ -1618,6 +2230,14 @@ grapheme_bidirectional_reorder_line(const uint_least32_t *line,
 		/* return required size */
 		return outputlen;
 	}
+	if (max_level == 0) {
+		/*
+		 * All characters are at level 0, which the paragraph
+		 * level also has to be, such that rule L1 changes
+		 * nothing and there is nothing to reverse
+		 */
+		return outputlen;
+	}
 
 	/*
 	 * write line embedding levels as metadata and codepoints into the
@@ -1626,112 +2246,457 @@ grapheme_bidirectional_reorder_line(const uint_least32_t *line,
 	get_line_embedding_levels(linedata, linelen, get_level_uint32,
 	                          set_level_uint32, output, outputsize, true);
 
-	/* determine level range */
-	for (i = 0; i < outputlen; i++) {
+	/* determine the lowest odd level */
+	for (i = 0, stack.min_odd_level = MAX_DEPTH + 2; i < outputlen; i++) {
 		level = get_level_uint32(output, i);
 
-		if (level == -1) {
-			/* ignored character */
-			continue;
+		if (level % 2 == 1 && level < stack.min_odd_level) {
+			stack.min_odd_level = level;
+		}
+	}
+
+	if (reinvert_clusters) {
+		mark_grapheme_clusters(line, linedata, linelen, output);
+	}
+
+	/* rule L2 */
+	for (i = 0, stack.depth = 0; i < outputlen; i++) {
+		sequence_stack_push(&stack, get_level_uint32(output, i), i,
+		                    reverse_output, output);
+	}
+	sequence_stack_push(&stack, -1, outputlen, reverse_output, output);
+
+	if (reinvert_clusters) {
+		reinvert_grapheme_clusters(output, outputlen,
+		                           stack.min_odd_level);
+	}
+
+	/* remove embedding level and grapheme cluster metadata */
+	for (i = 0; i < outputlen; i++) {
+		output[i] ^= output[i] & UINT32_C(0x7FE00000);
+	}
+
+	return outputlen;
+}
+
+size_t
+grapheme_bidirectional_reorder_line(const uint_least32_t *line,
+                                    const uint_least32_t *linedata,
+                                    size_t linelen, uint_least32_t *output,
+                                    size_t outputsize)
+{
+	return reorder_line(line, linedata, linelen, output, outputsize,
+	                    false);
+}
+
+size_t
+grapheme_bidirectional_reorder_line_clusters(const uint_least32_t *line,
+                                             const uint_least32_t *linedata,
+                                             size_t linelen,
+                                             uint_least32_t *output,
+                                             size_t outputsize)
+{
+	return reorder_line(line, linedata, linelen, output, outputsize,
+	                    true);
+}
+
+static inline size_t
+get_trailing_run(const uint_least32_t *linedata, size_t linelen)
+{
+	enum bidi_property prop;
+	size_t i;
+
+	/*
+	 * determine the offset of the trailing run of whitespace and
+	 * isolate formatting characters, which are reset to the
+	 * paragraph level by rule L1.4, ignoring removed characters
+	 */
+	for (i = linelen; i > 0; i--) {
+		prop = (uint_least8_t)get_state(STATE_PRESERVED_PROP,
+		                                linedata[i - 1]);
+
+		if (get_state(STATE_LEVEL, linedata[i - 1]) != -1 &&
+		    prop != BIDI_PROP_WS && prop != BIDI_PROP_FSI &&
+		    prop != BIDI_PROP_LRI && prop != BIDI_PROP_RLI &&
+		    prop != BIDI_PROP_PDI) {
+			break;
 		}
+	}
+
+	return i;
+}
+
+static inline int_least8_t
+get_line_level(const uint_least32_t *linedata, size_t off, size_t trail)
+{
+	int_least8_t level;
+
+	/* apply rule L1.4 to the embedding level of a remaining character */
+	level = (int_least8_t)get_state(STATE_LEVEL, linedata[off]);
+	if (level != -1 && off >= trail) {
+		level = (int_least8_t)get_state(STATE_PARAGRAPH_LEVEL,
+		                                linedata[off]);
+	}
+
+	return level;
+}
 
-		if (level % 2 == 1 && level < min_odd_level) {
-			min_odd_level = level;
+static inline size_t
+get_utf8_sequence_length(unsigned char c)
+{
+	return (c < 0x80)           ? 1 :
+	       ((c & 0xE0) == 0xC0) ? 2 :
+	       ((c & 0xF0) == 0xE0) ? 3 :
+	                              4;
+}
+
+size_t
+grapheme_bidirectional_reorder_line_utf8(const char *line,
+                                         const uint_least32_t *linedata,
+                                         size_t linelen, char *output,
+                                         size_t outputsize)
+{
+	struct sequence_stack stack;
+	size_t i, srcoff, off, len, outputlen, trail;
+	uint_least32_t cp;
+	int_least8_t level, max_level = 0;
+
+	/*
+	 * write output characters (and apply possible mirroring) and
+	 * determine the line levels, which only differ from the
+	 * embedding levels by rule L1.4
+	 */
+	trail = get_trailing_run(linedata, linelen);
+	stack.min_odd_level = MAX_DEPTH + 2;
+	for (i = 0, srcoff = 0, outputlen = 0; i < linelen; i++) {
+		len = (size_t)get_state(STATE_SOURCE_LEN, linedata[i]);
+		level = get_line_level(linedata, i, trail);
+
+		if (level != -1) {
+			if (level > max_level) {
+				max_level = level;
+			}
+			if (level % 2 == 1 && level < stack.min_odd_level) {
+				stack.min_odd_level = level;
+			}
+
+			grapheme_decode_utf8(line + srcoff, len, &cp);
+			cp = (uint_least32_t)((int_least32_t)cp +
+			                      get_mirror_offset(cp));
+			if (outputlen < outputsize) {
+				outputlen += grapheme_encode_utf8(
+					cp, output + outputlen,
+					outputsize - outputlen);
+			} else {
+				outputlen += grapheme_encode_utf8(cp, NULL, 0);
+			}
+		}
+		srcoff += len;
+	}
+	if (outputlen >= outputsize) {
+		/* clear output buffer */
+		for (i = 0; i < outputsize; i++) {
+			output[i] = '\0';
 		}
+
+		/* return required size */
+		return outputlen;
+	}
+	output[outputlen] = '\0';
+	if (max_level == 0) {
+		/* there is nothing to reverse */
+		return outputlen;
+	}
+
+	/*
+	 * Rule L2 on the bytes: The length of each codepoint can be
+	 * read from its first byte, as the output is only reversed
+	 * before the current offset.
+	 */
+	for (i = 0, off = 0, stack.depth = 0; i < linelen; i++) {
+		level = get_line_level(linedata, i, trail);
+
+		if (level != -1) {
+			sequence_stack_push(&stack, level, off,
+			                    reverse_output_utf8, output);
+			off += get_utf8_sequence_length(
+				((unsigned char *)output)[off]);
+		}
+	}
+	sequence_stack_push(&stack, -1, outputlen, reverse_output_utf8,
+	                    output);
+
+	/* restore the byte order of the reversed codepoints */
+	for (off = 0; off < outputlen; off += len) {
+		if ((((unsigned char *)output)[off] & 0xC0) == 0x80) {
+			/* continuation byte, find the first byte */
+			for (len = 1; (((unsigned char *)output)[off + len] &
+			               0xC0) == 0x80;
+			     len++) {
+				;
+			}
+			len++;
+			reverse_output_utf8(output, off, off + len);
+		} else {
+			len = get_utf8_sequence_length(
+				((unsigned char *)output)[off]);
+		}
+	}
+
+	return outputlen;
+}
+
+size_t
+grapheme_bidirectional_reorder_line_map(const uint_least32_t *linedata,
+                                        size_t linelen, size_t *visual,
+                                        size_t visuallen, size_t *logical,
+                                        size_t logicallen)
+{
+	struct sequence_stack stack;
+	size_t i, trail, visuallen_needed;
+	int_least8_t level, max_level = 0;
+
+	/*
+	 * write the logical offsets of the remaining characters in
+	 * logical order, which rule L2 then reverses like the
+	 * codepoints in grapheme_bidirectional_reorder_line()
+	 */
+	trail = get_trailing_run(linedata, linelen);
+	stack.min_odd_level = MAX_DEPTH + 2;
+	for (i = 0, visuallen_needed = 0; i < linelen; i++) {
+		level = get_line_level(linedata, i, trail);
+
+		if (level != -1) {
+			if (level > max_level) {
+				max_level = level;
+			}
+			if (level % 2 == 1 && level < stack.min_odd_level) {
+				stack.min_odd_level = level;
+			}
+			if (visuallen_needed < visuallen) {
+				visual[visuallen_needed] = i;
+			}
+			visuallen_needed++;
+		}
+	}
+	if (visuallen_needed > visuallen) {
+		/* clear visual map */
+		for (i = 0; i < visuallen; i++) {
+			visual[i] = SIZE_MAX;
+		}
+
+		/* return required size */
+		return visuallen_needed;
+	}
+
+	if (max_level > 0) {
+		/*
+		 * rule L2, where the offset at the current position
+		 * is still the logical one, as the map is only
+		 * reversed before it
+		 */
+		for (i = 0, stack.depth = 0; i < visuallen_needed; i++) {
+			level = get_line_level(linedata, visual[i], trail);
+			sequence_stack_push(&stack, level, i, reverse_index,
+			                    visual);
+		}
+		sequence_stack_push(&stack, -1, visuallen_needed,
+		                    reverse_index, visual);
+	}
+
+	if (logical != NULL) {
+		/* invert the map, the removed characters have no position */
+		for (i = 0; i < MIN(linelen, logicallen); i++) {
+			logical[i] = SIZE_MAX;
+		}
+		for (i = 0; i < visuallen_needed; i++) {
+			if (visual[i] < logicallen) {
+				logical[visual[i]] = i;
+			}
+		}
+	}
+
+	return visuallen_needed;
+}
+
+static size_t
+reorder_line_runs(const uint_least32_t *linedata, size_t linelen,
+                  size_t lineoff, bool source,
+                  struct grapheme_bidirectional_run *run, size_t runlen)
+{
+	struct sequence_stack stack;
+	size_t i, off, trail, runcount;
+	int_least8_t level, runlevel = -1, max_level = 0;
+
+	/*
+	 * determine the runs of remaining characters with the same
+	 * level in logical order, where each removed character is
+	 * part of the run before it (or the first run). The offsets
+	 * begin at lineoff and count codepoints or, if source is set,
+	 * the source lengths of the codepoints.
+	 */
+	trail = get_trailing_run(linedata, linelen);
+	stack.min_odd_level = MAX_DEPTH + 2;
+	for (i = 0, off = lineoff, runcount = 0; i < linelen;
+	     off += source ? (size_t)get_state(STATE_SOURCE_LEN, linedata[i]) :
+	                     1,
+	     i++) {
+		level = get_line_level(linedata, i, trail);
+
+		if (level == -1 || level == runlevel) {
+			continue;
+		}
+		if (runcount > 0 && runcount <= runlen) {
+			run[runcount - 1].len = off - run[runcount - 1].off;
+		}
+		if (runcount < runlen) {
+			run[runcount].off = (runcount == 0) ? lineoff : off;
+			run[runcount].level = level;
+		}
+		runcount++;
+		runlevel = level;
+
 		if (level > max_level) {
 			max_level = level;
 		}
+		if (level % 2 == 1 && level < stack.min_odd_level) {
+			stack.min_odd_level = level;
+		}
+	}
+	if (runcount > runlen) {
+		/* return required size */
+		return runcount;
+	}
+	if (runcount > 0) {
+		run[runcount - 1].len = off - run[runcount - 1].off;
 	}
 
-	for (level = max_level; level >= min_odd_level /* > 0 */; level--) {
-		for (i = 0; i < outputlen; i++) {
-			if (get_level_uint32(output, i) >= level) {
-				/*
-				 * the current character has the desired level
-				 */
-				first = last = i;
-
-				/* find the end of the level-sequence */
-				for (i++; i < outputlen; i++) {
-					if (get_level_uint32(output, i) >=
-					    level) {
-						/* the sequence continues */
-						last = i;
-					} else {
-						break;
-					}
-				}
+	if (max_level > 0) {
+		/*
+		 * rule L2 on whole runs, as all characters of a run are
+		 * reversed together. A run is then shown from right to
+		 * left exactly if its level is odd.
+		 */
+		for (i = 0, stack.depth = 0; i < runcount; i++) {
+			sequence_stack_push(&stack, run[i].level, i,
+			                    reverse_run, run);
+		}
+		sequence_stack_push(&stack, -1, runcount, reverse_run, run);
+	}
 
-				/* invert the sequence first..last respecting
-				 * grapheme clusters
-				 *
-				 * The standard only speaks of combining marks
-				 * inversion, but we should in the perfect case
-				 * respect _all_ grapheme clusters, which we do
-				 * here!
-				 */
+	return runcount;
+}
 
-				/* mark grapheme cluster breaks */
-				for (j = first; j <= last;
-				     j += grapheme_next_character_break(
-					     line + j, outputlen - j)) {
-					/*
-					 * we use a special trick here: The
-					 * first 21 bits of the state are filled
-					 * with the codepoint, the next 8 bits
-					 * are used for the level, so we can use
-					 * the 30th bit to mark the grapheme
-					 * cluster breaks. This allows us to
-					 * reinvert the grapheme clusters into
-					 * the proper direction later.
-					 */
-					output[j] |= UINT32_C(1) << 29;
-				}
+size_t
+grapheme_bidirectional_reorder_line_runs(const uint_least32_t *linedata,
+                                         size_t linelen,
+                                         struct grapheme_bidirectional_run *run,
+                                         size_t runlen)
+{
+	return reorder_line_runs(linedata, linelen, 0, false, run, runlen);
+}
 
-				/* global inversion */
-				for (k = first, l = last; k < l; k++, l--) {
-					/* swap */
-					tmp = output[k];
-					output[k] = output[l];
-					output[l] = tmp;
-				}
+static size_t
+layout_paragraph(HERODOTUS_READER *r,
+                 enum grapheme_bidirectional_direction override,
+                 size_t columns, uint_least32_t *data, size_t datalen,
+                 struct grapheme_bidirectional_line *line, size_t linelen,
+                 size_t *linecount, struct grapheme_bidirectional_run *run,
+                 size_t runlen, size_t *runcount)
+{
+	HERODOTUS_READER tmp;
+	size_t len, parlen, off, end, srcoff, dataoff, dataend, count, runoff,
+		n;
 
-				/* grapheme cluster reinversion */
-#if 0
-				for (j = first, laststart = first; j <= last;
-				     j++) {
-					if (output[j] & (UINT32_C(1) << 29)) {
-						/* we hit a mark! given the
-						 * grapheme cluster is inverted,
-						 * this means that the cluster
-						 * ended and we now reinvert it
-						 * again
-						 */
-						for (k = laststart, l = j;
-						     k < l; k++, l--) {
-							/* swap */
-							tmp = output[k];
-							output[k] = output[l];
-							output[l] = tmp;
-						}
-						laststart = j + 1;
-					}
-				}
-#endif
+	/* resolve the levels of the paragraph once for all its lines */
+	herodotus_reader_copy(r, &tmp);
+	len = preprocess(&tmp, override, data, datalen, NULL, NULL);
+	parlen = herodotus_reader_number_read(&tmp);
 
-				/* unmark grapheme cluster breaks */
-				for (j = first; j <= last; j++) {
-					output[j] ^= output[j] &
-					             UINT32_C(0x20000000);
-				}
-			}
+	/*
+	 * Wrap the paragraph line by line, where the line breaker
+	 * must not look beyond the paragraph, and reorder each line
+	 * on its part of the states, which we find by adding up the
+	 * source lengths of the codepoints as we go. Like with the
+	 * other buffers, we return the required length of the states.
+	 * The lines are determined even if the states do not fit, but
+	 * their runs are not, and the number of lines and runs is
+	 * counted even if their arrays are too small.
+	 */
+	herodotus_reader_push_advance_limit(r, parlen);
+	for (off = 0, dataoff = 0, count = 0, runoff = 0; off < parlen;
+	     off = end, dataoff = dataend, count++) {
+		herodotus_reader_seek(r, off);
+		if ((end = wrap_line(r, columns, NULL)) == off) {
+			break;
+		}
+
+		for (dataend = dataoff, srcoff = off;
+		     dataend < MIN(len, datalen) && srcoff < end; dataend++) {
+			srcoff += (size_t)get_state(STATE_SOURCE_LEN,
+			                            data[dataend]);
+		}
+
+		if (len <= datalen) {
+			n = reorder_line_runs(
+				data + dataoff, dataend - dataoff, off, true,
+				(run == NULL) ? NULL :
+				                run + MIN(runoff, runlen),
+				runlen - MIN(runoff, runlen));
+		} else {
+			/* we cannot reorder without the complete states */
+			n = 0;
+		}
+
+		if (line != NULL && count < linelen) {
+			line[count].off = off;
+			line[count].len = end - off;
+			line[count].runoff = runoff;
+			line[count].runcount = n;
 		}
+		runoff += n;
 	}
 
-	/* remove embedding level metadata */
-	for (i = 0; i < outputlen; i++) {
-		output[i] ^= output[i] & UINT32_C(0x1FE00000);
+	if (linecount != NULL) {
+		*linecount = count;
+	}
+	if (runcount != NULL) {
+		*runcount = runoff;
 	}
 
-	return outputlen;
+	return len;
+}
+
+size_t
+grapheme_bidirectional_layout_paragraph(
+	const uint_least32_t *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, size_t columns,
+	uint_least32_t *data, size_t datalen,
+	struct grapheme_bidirectional_line *line, size_t linelen,
+	size_t *linecount, struct grapheme_bidirectional_run *run,
+	size_t runlen, size_t *runcount)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
+
+	return layout_paragraph(&r, override, columns, data, datalen, line,
+	                        linelen, linecount, run, runlen, runcount);
+}
+
+size_t
+grapheme_bidirectional_layout_paragraph_utf8(
+	const char *src, size_t srclen,
+	enum grapheme_bidirectional_direction override, size_t columns,
+	uint_least32_t *data, size_t datalen,
+	struct grapheme_bidirectional_line *line, size_t linelen,
+	size_t *linecount, struct grapheme_bidirectional_run *run,
+	size_t runlen, size_t *runcount)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+
+	return layout_paragraph(&r, override, columns, data, datalen, line,
+	                        linelen, linecount, run, runlen, runcount);
 }
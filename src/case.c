@@ -1,4 +1,5 @@
 /* See LICENSE file for copyright and license details. */
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -18,123 +19,251 @@ get_case_property(uint_least32_t cp)
 }
 
 static inline int_least32_t
-get_case_offset(uint_least32_t cp, const uint_least16_t *major,
-                const int_least32_t *minor)
+get_case_offset(uint_least32_t cp, const int_least32_t *offset)
 {
 	if (likely(cp <= UINT32_C(0x10FFFF))) {
 		/*
-		 * this value might be larger than or equal to 0x110000
+		 * All three case mappings share one index, which leaves
+		 * only the small offset array to differ between them.
+		 * The value might be larger than or equal to 0x110000
 		 * for the special-case-mapping. This needs to be handled
 		 * separately
 		 */
-		return minor[major[cp >> 8] + (cp & 0xFF)];
+		return offset[case_mapping_minor[case_mapping_major[cp >> 8] +
+		                                 (cp & 0xFF)]];
 	} else {
 		return 0;
 	}
 }
 
-static inline size_t
-to_case(HERODOTUS_READER *r, HERODOTUS_WRITER *w,
-        uint_least8_t final_sigma_level, const uint_least16_t *major,
-        const int_least32_t *minor, const struct special_case *sc)
+static inline uint_least8_t
+update_final_sigma_level(uint_least8_t final_sigma_level,
+                         enum case_property prop)
 {
-	HERODOTUS_READER tmp;
-	enum case_property prop;
-	enum herodotus_status s;
-	size_t off, i;
-	uint_least32_t cp, tmp_cp;
-	int_least32_t map;
+	if ((final_sigma_level == 0 || final_sigma_level == 1) &&
+	    (prop == CASE_PROP_CASED ||
+	     prop == CASE_PROP_BOTH_CASED_CASE_IGNORABLE)) {
+		/* sequence has begun */
+		return 1;
+	} else if ((final_sigma_level == 1 || final_sigma_level == 2) &&
+	           (prop == CASE_PROP_CASE_IGNORABLE ||
+	            prop == CASE_PROP_BOTH_CASED_CASE_IGNORABLE)) {
+		/* case-ignorable sequence begins or continued */
+		return 2;
+	} else {
+		/* sequence broke */
+		return 0;
+	}
+}
 
-	for (; herodotus_read_codepoint(r, true, &cp) ==
-	       HERODOTUS_STATUS_SUCCESS;) {
-		if (sc == lower_special) {
-			/*
-			 * For the special Final_Sigma-rule (see
-			 * SpecialCasing.txt), which is the only non-localized
-			 * case-dependent rule, we apply a different mapping
-			 * when a sigma is at the end of a word.
-			 *
-			 * Before: cased case-ignorable*
-			 * After: not(case-ignorable* cased)
-			 *
-			 * We check the after-condition on demand, but the
-			 * before- condition is best checked using the
-			 * "level"-heuristic also used in the sentence and line
-			 * breaking-implementations.
-			 */
-			if (cp == UINT32_C(0x03A3) && /* GREEK CAPITAL LETTER
-			                                 SIGMA */
-			    (final_sigma_level == 1 ||
-			     final_sigma_level == 2)) {
-				/*
-				 * check succeeding characters by first skipping
-				 * all case-ignorable characters and then
-				 * checking if the succeeding character is
-				 * cased, invalidating the after-condition
-				 */
-				herodotus_reader_copy(r, &tmp);
-				for (prop = NUM_CASE_PROPS;
-				     (s = herodotus_read_codepoint(&tmp, true,
-				                                   &tmp_cp)) ==
-				     HERODOTUS_STATUS_SUCCESS;) {
-					prop = get_case_property(tmp_cp);
-
-					if (prop != CASE_PROP_CASE_IGNORABLE &&
-					    prop != CASE_PROP_BOTH_CASED_CASE_IGNORABLE) {
-						break;
-					}
-				}
+static inline void
+ascii_word_store(unsigned char *d, uint_least64_t x)
+{
+	d[0] = (unsigned char)(x & 0xff);
+	d[1] = (unsigned char)((x >> 8) & 0xff);
+	d[2] = (unsigned char)((x >> 16) & 0xff);
+	d[3] = (unsigned char)((x >> 24) & 0xff);
+	d[4] = (unsigned char)((x >> 32) & 0xff);
+	d[5] = (unsigned char)((x >> 40) & 0xff);
+	d[6] = (unsigned char)((x >> 48) & 0xff);
+	d[7] = (unsigned char)((x >> 56) & 0xff);
+}
 
-				/*
-				 * Now prop is something other than
-				 * case-ignorable or the source-string ended. If
-				 * it is something other than cased, we know
-				 * that the after-condition holds
-				 */
-				if (s != HERODOTUS_STATUS_SUCCESS ||
-				    (prop != CASE_PROP_CASED &&
-				     prop != CASE_PROP_BOTH_CASED_CASE_IGNORABLE)) {
-					/*
-					 * write GREEK SMALL LETTER FINAL SIGMA
-					 * to destination
-					 */
-					herodotus_write_codepoint(
-						w, UINT32_C(0x03C2));
+static inline uint_least64_t
+ascii_word_in_range(uint_least64_t x, unsigned char first, unsigned char last)
+{
+	/*
+	 * All bytes are below 0x80, so adding 0x80 - first sets the
+	 * high bit of each byte that is at least first and adding
+	 * 0x7f - last sets it for each byte that is greater than last,
+	 * without carrying into the neighbouring byte. The high bit
+	 * remains set for the bytes in [first, last].
+	 */
+	return ((x + ASCII_WORD(0x80 - first)) ^
+	        (x + ASCII_WORD(0x7f - last))) &
+	       ASCII_WORD(0x80);
+}
 
-					/* reset Final_Sigma-state and continue
-					 */
-					final_sigma_level = 0;
-					continue;
+static inline uint_least64_t
+ascii_word_to_case(uint_least64_t x, unsigned char first, unsigned char last)
+{
+	/* the bytes in [first, last] have their case bit 0x20 flipped */
+	return x ^ (ascii_word_in_range(x, first, last) >> 2);
+}
+
+static inline void
+to_case_ascii(HERODOTUS_READER *r, HERODOTUS_WRITER *w, bool lower,
+              uint_least8_t *final_sigma_level)
+{
+	enum case_property prop;
+	const void *window;
+	const unsigned char *src;
+	void *out;
+	unsigned char *dest, first, last;
+	size_t len, room, i, j;
+	uint_least64_t x;
+	bool nul_terminated;
+
+	/*
+	 * We convert the run of ASCII characters at the reader
+	 * position directly, which saves decoding, the table lookups
+	 * and encoding for each of them. ASCII characters have no
+	 * special case mappings and the only ones that change are the
+	 * latin letters. The reader and writer are left in the state
+	 * they would have been in had we read and written each
+	 * character separately.
+	 */
+	if ((len = herodotus_reader_window(r, HERODOTUS_TYPE_UTF8, &window,
+	                                   &nul_terminated)) == 0 ||
+	    (src = window)[0] >= 0x80) {
+		return;
+	}
+	room = herodotus_writer_window(w, &out);
+	dest = out;
+
+	if (lower) {
+		first = 'A';
+		last = 'Z';
+	} else {
+		/* the titlecase of an ASCII character is its uppercase */
+		first = 'a';
+		last = 'z';
+	}
+
+	i = 0;
+	if (!nul_terminated) {
+		/*
+		 * We know the length of the input, which allows us to
+		 * read words without having to look out for a
+		 * terminating NUL-byte.
+		 */
+		for (; len - i >= 8; i += 8) {
+			x = ascii_word_load(src + i);
+			if (x & ASCII_WORD(0x80)) {
+				/* there is a non-ASCII byte in the word */
+				break;
+			}
+			x = ascii_word_to_case(x, first, last);
+			if (room - MIN(room, i) >= 8) {
+				ascii_word_store(dest + i, x);
+			} else {
+				for (j = i; j < room; j++) {
+					dest[j] = (unsigned char)(x & 0xff);
+					x >>= 8;
 				}
 			}
+		}
+	}
+	for (; i < len && src[i] < 0x80; i++) {
+		if (src[i] == '\0' && nul_terminated) {
+			/* leave the terminating NUL-byte to the reader */
+			break;
+		}
+		if (i < room) {
+			dest[i] = (src[i] >= first && src[i] <= last) ?
+			                  (unsigned char)(src[i] ^ 0x20) :
+			                  src[i];
+		}
+	}
 
-			/* update state */
-			prop = get_case_property(cp);
-			if ((final_sigma_level == 0 ||
-			     final_sigma_level == 1) &&
-			    (prop == CASE_PROP_CASED ||
-			     prop == CASE_PROP_BOTH_CASED_CASE_IGNORABLE)) {
-				/* sequence has begun */
-				final_sigma_level = 1;
-			} else if (
-				(final_sigma_level == 1 ||
-			         final_sigma_level == 2) &&
-				(prop == CASE_PROP_CASE_IGNORABLE ||
-			         prop == CASE_PROP_BOTH_CASED_CASE_IGNORABLE)) {
-				/* case-ignorable sequence begins or continued
-				 */
-				final_sigma_level = 2;
-			} else {
-				/* sequence broke */
-				final_sigma_level = 0;
+	if (lower && final_sigma_level != NULL && i > 0 && i < len) {
+		/*
+		 * Only characters that are neither cased nor
+		 * case-ignorable reset the Final_Sigma-state
+		 * unconditionally, so we only have to follow it from
+		 * the last of them on. If the run extends to the end
+		 * of the input, as is common for short strings, no
+		 * sigma follows and the state is not needed at all.
+		 */
+		for (j = i; j > 0; j--) {
+			prop = get_case_property(src[j - 1]);
+			if (prop != CASE_PROP_CASED &&
+			    prop != CASE_PROP_CASE_IGNORABLE &&
+			    prop != CASE_PROP_BOTH_CASED_CASE_IGNORABLE) {
+				*final_sigma_level = 0;
+				break;
 			}
 		}
+		for (; j < i; j++) {
+			*final_sigma_level = update_final_sigma_level(
+				*final_sigma_level, get_case_property(src[j]));
+		}
+	}
 
-		/* get and handle case mapping */
-		if (unlikely((map = get_case_offset(cp, major, minor)) >=
+	/* update the reader and writer as if we had written byte-wise */
+	herodotus_reader_advance(r, i);
+	herodotus_writer_advance(w, i);
+}
+
+/*
+ * the full case mappings are at most three codepoints long, and a case
+ * folding is made up of three of them
+ */
+#define CASE_MAPPING_MAX 3
+#define CASE_FOLDING_MAX                                  \
+	(CASE_MAPPING_MAX * CASE_MAPPING_MAX * CASE_MAPPING_MAX)
+
+static inline size_t
+map_codepoint(uint_least32_t cp, const int_least32_t *offset,
+              const struct special_case *sc, uint_least32_t *out)
+{
+	size_t off, i;
+	int_least32_t map;
+
+	if (unlikely((map = get_case_offset(cp, offset)) >=
+	             INT32_C(0x110000))) {
+		/* we have a special case */
+		off = (uint_least32_t)map - UINT32_C(0x110000);
+
+		for (i = 0; i < sc[off].cplen && i < CASE_MAPPING_MAX; i++) {
+			out[i] = sc[off].cp[i];
+		}
+
+		return i;
+	} else {
+		/* we have a simple mapping */
+		out[0] = (uint_least32_t)((int_least32_t)cp + map);
+
+		return 1;
+	}
+}
+
+static inline size_t
+encoded_length(enum herodotus_type type, uint_least32_t cp)
+{
+	if (type == HERODOTUS_TYPE_CODEPOINT) {
+		return 1;
+	} else { /* type == HERODOTUS_TYPE_UTF8 */
+		return grapheme_encode_utf8(cp, NULL, 0);
+	}
+}
+
+static inline size_t
+to_case_length(HERODOTUS_READER *r, HERODOTUS_WRITER *w,
+               const int_least32_t *offset, const struct special_case *sc)
+{
+	size_t off, i;
+	uint_least32_t cp;
+	int_least32_t map;
+
+	/*
+	 * When nothing is written we only have to determine the length
+	 * of the output. ASCII characters are mapped to ASCII
+	 * characters, which allows us to skip runs of them at once.
+	 * The Final_Sigma-rule can also be ignored, as both the final
+	 * and the non-final small sigma have the same length.
+	 */
+	for (;;) {
+		herodotus_writer_advance(w, herodotus_reader_skip_ascii(r));
+
+		if (herodotus_read_codepoint(r, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+
+		if (unlikely((map = get_case_offset(cp, offset)) >=
 		             INT32_C(0x110000))) {
-			/* we have a special case and the offset in the sc-array
-			 * is the difference to 0x110000*/
+			/* we have a special case */
 			off = (uint_least32_t)map - UINT32_C(0x110000);
 
 			for (i = 0; i < sc[off].cplen; i++) {
@@ -147,36 +276,238 @@ to_case(HERODOTUS_READER *r, HERODOTUS_WRITER *w,
 		}
 	}
 
+	return herodotus_writer_number_written(w);
+}
+
+static inline size_t
+map_case(const HERODOTUS_READER *r, uint_least32_t cp,
+         uint_least8_t *final_sigma_level, const int_least32_t *offset,
+         const struct special_case *sc, uint_least32_t *out)
+{
+	HERODOTUS_READER tmp;
+	enum case_property prop;
+	enum herodotus_status s;
+	uint_least32_t tmp_cp;
+
+	if (sc == lower_special) {
+		/*
+		 * For the special Final_Sigma-rule (see
+		 * SpecialCasing.txt), which is the only non-localized
+		 * case-dependent rule, we apply a different mapping
+		 * when a sigma is at the end of a word.
+		 *
+		 * Before: cased case-ignorable*
+		 * After: not(case-ignorable* cased)
+		 *
+		 * We check the after-condition on demand, but the
+		 * before- condition is best checked using the
+		 * "level"-heuristic also used in the sentence and line
+		 * breaking-implementations.
+		 */
+		if (cp == UINT32_C(0x03A3) && /* GREEK CAPITAL LETTER SIGMA */
+		    (*final_sigma_level == 1 || *final_sigma_level == 2)) {
+			/*
+			 * check succeeding characters by first skipping
+			 * all case-ignorable characters and then
+			 * checking if the succeeding character is
+			 * cased, invalidating the after-condition.
+			 *
+			 * The sigma is cased and not case-ignorable,
+			 * so this lookahead stops at the next sigma
+			 * at the latest and the lookaheads of all
+			 * sigmas cover disjoint stretches of the
+			 * input, keeping the conversion linear.
+			 */
+			herodotus_reader_copy(r, &tmp);
+			for (prop = NUM_CASE_PROPS;
+			     (s = herodotus_read_codepoint(&tmp, true,
+			                                   &tmp_cp)) ==
+			     HERODOTUS_STATUS_SUCCESS;) {
+				prop = get_case_property(tmp_cp);
+
+				if (prop != CASE_PROP_CASE_IGNORABLE &&
+				    prop != CASE_PROP_BOTH_CASED_CASE_IGNORABLE) {
+					break;
+				}
+			}
+
+			/*
+			 * Now prop is something other than
+			 * case-ignorable or the source-string ended. If
+			 * it is something other than cased, we know
+			 * that the after-condition holds
+			 */
+			if (s != HERODOTUS_STATUS_SUCCESS ||
+			    (prop != CASE_PROP_CASED &&
+			     prop != CASE_PROP_BOTH_CASED_CASE_IGNORABLE)) {
+				/* map to GREEK SMALL LETTER FINAL SIGMA */
+				out[0] = UINT32_C(0x03C2);
+
+				/* reset Final_Sigma-state */
+				*final_sigma_level = 0;
+				return 1;
+			}
+		}
+
+		/* update state */
+		*final_sigma_level = update_final_sigma_level(
+			*final_sigma_level, get_case_property(cp));
+	}
+
+	return map_codepoint(cp, offset, sc, out);
+}
+
+static inline void
+to_case_unterminated(HERODOTUS_READER *r, HERODOTUS_WRITER *w,
+                     uint_least8_t final_sigma_level,
+                     const int_least32_t *offset,
+                     const struct special_case *sc)
+{
+	size_t n, i;
+	uint_least32_t cp, mapped[CASE_MAPPING_MAX];
+
+	for (;;) {
+		to_case_ascii(r, w, sc == lower_special, &final_sigma_level);
+		if (herodotus_read_codepoint(r, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+
+		n = map_case(r, cp, &final_sigma_level, offset, sc, mapped);
+		for (i = 0; i < n; i++) {
+			herodotus_write_codepoint(w, mapped[i]);
+		}
+	}
+}
+
+static inline size_t
+to_case(HERODOTUS_READER *r, HERODOTUS_WRITER *w,
+        uint_least8_t final_sigma_level, const int_least32_t *offset,
+        const struct special_case *sc)
+{
+	if (herodotus_writer_window(w, NULL) == 0) {
+		/* nothing is written, so we only determine the length */
+		to_case_length(r, w, offset, sc);
+	} else {
+		to_case_unterminated(r, w, final_sigma_level, offset, sc);
+	}
 	herodotus_writer_nul_terminate(w);
 
 	return herodotus_writer_number_written(w);
 }
 
-static size_t
-herodotus_next_word_break(const HERODOTUS_READER *r)
+static inline size_t
+to_case_batch(enum herodotus_type type, const void *src,
+              const size_t *srclen, size_t count, void *dest,
+              size_t destlen, size_t *ends, const int_least32_t *offset,
+              const struct special_case *sc)
 {
-	HERODOTUS_READER tmp;
+	HERODOTUS_READER r;
+	HERODOTUS_WRITER w;
+	size_t i;
+
+	/*
+	 * All strings are converted by the same writer, such that they
+	 * end up back-to-back in the destination as if they had been
+	 * a single string, and only the whole arena is NUL-terminated.
+	 * Each string has its own reader, as the Final_Sigma-rule must
+	 * not look across the string boundaries.
+	 */
+	herodotus_writer_init(&w, type, dest, destlen);
+
+	for (i = 0; i < count; i++) {
+		if (type == HERODOTUS_TYPE_CODEPOINT) {
+			herodotus_reader_init(
+				&r, type,
+				((const uint_least32_t *const *)src)[i],
+				srclen[i]);
+		} else { /* type == HERODOTUS_TYPE_UTF8 */
+			herodotus_reader_init(&r, type,
+			                      ((const char *const *)src)[i],
+			                      srclen[i]);
+		}
+
+		if (dest == NULL || destlen == 0) {
+			/* nothing is written, only determine the length */
+			to_case_length(&r, &w, offset, sc);
+		} else {
+			to_case_unterminated(&r, &w, 0, offset, sc);
+		}
 
-	herodotus_reader_copy(r, &tmp);
+		if (ends != NULL) {
+			ends[i] = herodotus_writer_number_written(&w);
+		}
+	}
+
+	herodotus_writer_nul_terminate(&w);
+
+	return herodotus_writer_number_written(&w);
+}
 
-	if (r->type == HERODOTUS_TYPE_CODEPOINT) {
-		return grapheme_next_word_break(tmp.src, tmp.srclen);
-	} else { /* r->type == HERODOTUS_TYPE_UTF8 */
-		return grapheme_next_word_break_utf8(tmp.src, tmp.srclen);
+static inline size_t
+to_case_inplace(enum herodotus_type type, void *str, size_t len,
+                const int_least32_t *offset, const struct special_case *sc)
+{
+	HERODOTUS_READER r;
+	HERODOTUS_WRITER w;
+	uint_least8_t final_sigma_level = 0;
+	size_t off, maplen, n, i;
+	uint_least32_t cp, mapped[CASE_MAPPING_MAX];
+
+	/*
+	 * The writer trails the reader on the same buffer and only
+	 * overwrites what has already been read, as long as each
+	 * mapping has the same length as its source. The Final_Sigma
+	 * lookahead reads past the reader, where nothing has been
+	 * overwritten yet, and the ASCII run conversion only looks
+	 * back at converted ASCII characters, which keep their case
+	 * properties.
+	 */
+	herodotus_reader_init(&r, type, str, len);
+	herodotus_writer_init(&w, type, str, SIZE_MAX);
+
+	for (;;) {
+		to_case_ascii(&r, &w, sc == lower_special, &final_sigma_level);
+		off = herodotus_reader_number_read(&r);
+		if (herodotus_read_codepoint(&r, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+
+		n = map_case(&r, cp, &final_sigma_level, offset, sc, mapped);
+		for (i = 0, maplen = 0; i < n; i++) {
+			maplen += encoded_length(type, mapped[i]);
+		}
+		if (maplen != herodotus_reader_number_read(&r) - off) {
+			/* the mapping changes the length, stop before it */
+			return off;
+		}
+		for (i = 0; i < n; i++) {
+			herodotus_write_codepoint(&w, mapped[i]);
+		}
 	}
+
+	return herodotus_reader_number_read(&r);
 }
 
 static inline size_t
 to_titlecase(HERODOTUS_READER *r, HERODOTUS_WRITER *w)
 {
+	struct word_break_iterator it;
 	enum case_property prop;
 	enum herodotus_status s;
-	uint_least32_t cp;
-	size_t nwb;
+	uint_least32_t cp, mapped[CASE_MAPPING_MAX];
+	size_t nwb, n, i;
 
-	for (; (nwb = herodotus_next_word_break(r)) > 0;) {
+	/*
+	 * The words are determined by a single word break iterator running
+	 * ahead of the reader, such that the text is only segmented once.
+	 */
+	word_break_iterator_init(&it, r);
+
+	for (; (nwb = word_break_iterator_next(&it)) > 0;) {
 		herodotus_reader_push_advance_limit(r, nwb);
-		for (; (s = herodotus_read_codepoint(r, false, &cp)) ==
+		for (; (s = herodotus_read_codepoint(r, true, &cp)) ==
 		       HERODOTUS_STATUS_SUCCESS;) {
 			/* check if we have a cased character */
 			prop = get_case_property(cp);
@@ -187,9 +518,6 @@ to_titlecase(HERODOTUS_READER *r, HERODOTUS_WRITER *w)
 				/* write the data to the output verbatim, it if
 				 * permits */
 				herodotus_write_codepoint(w, cp);
-
-				/* increment reader */
-				herodotus_read_codepoint(r, true, &cp);
 			}
 		}
 
@@ -209,15 +537,15 @@ to_titlecase(HERODOTUS_READER *r, HERODOTUS_WRITER *w)
 			 * we encountered a cased character before the word
 			 * break, convert it to titlecase
 			 */
-			herodotus_reader_push_advance_limit(
-				r, herodotus_reader_next_codepoint_break(r));
-			to_case(r, w, 0, title_major, title_minor,
-			        title_special);
-			herodotus_reader_pop_limit(r);
+			n = map_codepoint(cp, title_offset, title_special,
+			                  mapped);
+			for (i = 0; i < n; i++) {
+				herodotus_write_codepoint(w, mapped[i]);
+			}
 		}
 
 		/* cast the rest of the codepoints in the word to lowercase */
-		to_case(r, w, 1, lower_major, lower_minor, lower_special);
+		to_case(r, w, 1, lower_offset, lower_special);
 
 		/* remove the limit on the word before the next iteration */
 		herodotus_reader_pop_limit(r);
@@ -238,7 +566,7 @@ grapheme_to_uppercase(const uint_least32_t *src, size_t srclen,
 	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
 	herodotus_writer_init(&w, HERODOTUS_TYPE_CODEPOINT, dest, destlen);
 
-	return to_case(&r, &w, 0, upper_major, upper_minor, upper_special);
+	return to_case(&r, &w, 0, upper_offset, upper_special);
 }
 
 size_t
@@ -251,7 +579,7 @@ grapheme_to_lowercase(const uint_least32_t *src, size_t srclen,
 	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
 	herodotus_writer_init(&w, HERODOTUS_TYPE_CODEPOINT, dest, destlen);
 
-	return to_case(&r, &w, 0, lower_major, lower_minor, lower_special);
+	return to_case(&r, &w, 0, lower_offset, lower_special);
 }
 
 size_t
@@ -277,7 +605,7 @@ grapheme_to_uppercase_utf8(const char *src, size_t srclen, char *dest,
 	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
 	herodotus_writer_init(&w, HERODOTUS_TYPE_UTF8, dest, destlen);
 
-	return to_case(&r, &w, 0, upper_major, upper_minor, upper_special);
+	return to_case(&r, &w, 0, upper_offset, upper_special);
 }
 
 size_t
@@ -290,7 +618,7 @@ grapheme_to_lowercase_utf8(const char *src, size_t srclen, char *dest,
 	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
 	herodotus_writer_init(&w, HERODOTUS_TYPE_UTF8, dest, destlen);
 
-	return to_case(&r, &w, 0, lower_major, lower_minor, lower_special);
+	return to_case(&r, &w, 0, lower_offset, lower_special);
 }
 
 size_t
@@ -306,20 +634,514 @@ grapheme_to_titlecase_utf8(const char *src, size_t srclen, char *dest,
 	return to_titlecase(&r, &w);
 }
 
+size_t
+grapheme_to_uppercase_inplace(uint_least32_t *str, size_t len)
+{
+	return to_case_inplace(HERODOTUS_TYPE_CODEPOINT, str, len, upper_offset,
+	                       upper_special);
+}
+
+size_t
+grapheme_to_lowercase_inplace(uint_least32_t *str, size_t len)
+{
+	return to_case_inplace(HERODOTUS_TYPE_CODEPOINT, str, len, lower_offset,
+	                       lower_special);
+}
+
+size_t
+grapheme_to_uppercase_inplace_utf8(char *str, size_t len)
+{
+	return to_case_inplace(HERODOTUS_TYPE_UTF8, str, len, upper_offset,
+	                       upper_special);
+}
+
+size_t
+grapheme_to_lowercase_inplace_utf8(char *str, size_t len)
+{
+	return to_case_inplace(HERODOTUS_TYPE_UTF8, str, len, lower_offset,
+	                       lower_special);
+}
+
+size_t
+grapheme_to_uppercase_batch(const uint_least32_t *const *src,
+                            const size_t *srclen, size_t count,
+                            uint_least32_t *dest, size_t destlen, size_t *ends)
+{
+	return to_case_batch(HERODOTUS_TYPE_CODEPOINT, src, srclen, count, dest,
+	                     destlen, ends, upper_offset, upper_special);
+}
+
+size_t
+grapheme_to_lowercase_batch(const uint_least32_t *const *src,
+                            const size_t *srclen, size_t count,
+                            uint_least32_t *dest, size_t destlen, size_t *ends)
+{
+	return to_case_batch(HERODOTUS_TYPE_CODEPOINT, src, srclen, count, dest,
+	                     destlen, ends, lower_offset, lower_special);
+}
+
+size_t
+grapheme_to_uppercase_batch_utf8(const char *const *src, const size_t *srclen,
+                                 size_t count, char *dest, size_t destlen,
+                                 size_t *ends)
+{
+	return to_case_batch(HERODOTUS_TYPE_UTF8, src, srclen, count, dest,
+	                     destlen, ends, upper_offset, upper_special);
+}
+
+size_t
+grapheme_to_lowercase_batch_utf8(const char *const *src, const size_t *srclen,
+                                 size_t count, char *dest, size_t destlen,
+                                 size_t *ends)
+{
+	return to_case_batch(HERODOTUS_TYPE_UTF8, src, srclen, count, dest,
+	                     destlen, ends, lower_offset, lower_special);
+}
+
+/*
+ * Codepoint ranges where the simple or full folding of CaseFolding.txt
+ * differs from the lowercase of the uppercase of the lowercase: The
+ * dotless i has no folding, as it would otherwise equal the capital I
+ * and the dotted i, and Cherokee is folded to its uppercase, as its
+ * lowercase letters were only added later (Unicode 8.0) and folding
+ * has to be stable. Each codepoint in a range is folded to itself
+ * plus the given offset.
+ */
+static const struct {
+	uint_least32_t first;
+	uint_least32_t last;
+	int_least32_t offset;
+} fold_exception[] = {
+	{ UINT32_C(0x0131), UINT32_C(0x0131), 0 },
+	{ UINT32_C(0x13A0), UINT32_C(0x13F5), 0 },
+	{ UINT32_C(0x13F8), UINT32_C(0x13FD), -0x8 },
+	{ UINT32_C(0xAB70), UINT32_C(0xABBF), -0x97D0 },
+};
+
+static size_t
+fold_codepoint(uint_least32_t cp, uint_least32_t *out)
+{
+	uint_least32_t lower[CASE_MAPPING_MAX],
+		upper[CASE_MAPPING_MAX * CASE_MAPPING_MAX];
+	size_t lowerlen, upperlen, i, n;
+
+	/*
+	 * We fold a codepoint by taking the lowercase of the uppercase
+	 * of its lowercase. Unlike the lowercase alone, this also
+	 * unifies characters like the sharp s and "ss" or the final
+	 * sigma and the sigma that only differ in their uppercase,
+	 * and the first lowercase mapping brings the capital sharp s
+	 * into this fold. No context is taken into account, in
+	 * particular not the Final_Sigma-rule. The few codepoints
+	 * where this differs from CaseFolding.txt are handled
+	 * separately.
+	 */
+	if (cp < 0x80) {
+		out[0] = (cp >= 'A' && cp <= 'Z') ? (cp | 0x20) : cp;
+		return 1;
+	}
+	for (i = 0; i < LEN(fold_exception); i++) {
+		if (cp >= fold_exception[i].first &&
+		    cp <= fold_exception[i].last) {
+			out[0] = (uint_least32_t)((int_least32_t)cp +
+			                          fold_exception[i].offset);
+			return 1;
+		}
+	}
+
+	lowerlen = map_codepoint(cp, lower_offset, lower_special, lower);
+	for (i = 0, upperlen = 0; i < lowerlen; i++) {
+		upperlen += map_codepoint(lower[i], upper_offset, upper_special,
+		                          upper + upperlen);
+	}
+	for (i = 0, n = 0; i < upperlen; i++) {
+		n += map_codepoint(upper[i], lower_offset, lower_special,
+		                   out + n);
+	}
+
+	return n;
+}
+
+static size_t
+fold_case(HERODOTUS_READER *r, HERODOTUS_WRITER *w)
+{
+	uint_least32_t cp, folded[CASE_FOLDING_MAX];
+	size_t foldedlen, i;
+
+	for (;;) {
+		to_case_ascii(r, w, true, NULL);
+		if (herodotus_read_codepoint(r, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+
+		foldedlen = fold_codepoint(cp, folded);
+		for (i = 0; i < foldedlen; i++) {
+			herodotus_write_codepoint(w, folded[i]);
+		}
+	}
+
+	herodotus_writer_nul_terminate(w);
+
+	return herodotus_writer_number_written(w);
+}
+
+size_t
+grapheme_fold_case(const uint_least32_t *src, size_t srclen,
+                   uint_least32_t *dest, size_t destlen)
+{
+	HERODOTUS_READER r;
+	HERODOTUS_WRITER w;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
+	herodotus_writer_init(&w, HERODOTUS_TYPE_CODEPOINT, dest, destlen);
+
+	return fold_case(&r, &w);
+}
+
+size_t
+grapheme_fold_case_utf8(const char *src, size_t srclen, char *dest,
+                        size_t destlen)
+{
+	HERODOTUS_READER r;
+	HERODOTUS_WRITER w;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
+	herodotus_writer_init(&w, HERODOTUS_TYPE_UTF8, dest, destlen);
+
+	return fold_case(&r, &w);
+}
+
+struct caseless_reader {
+	HERODOTUS_READER r;
+	uint_least32_t folded[CASE_FOLDING_MAX];
+	size_t foldedlen, foldedoff;
+};
+
+static inline bool
+caseless_read_codepoint(struct caseless_reader *cr, uint_least32_t *cp)
+{
+	uint_least32_t tmp;
+
+	/* refill the folded codepoints once they are used up */
+	while (cr->foldedoff == cr->foldedlen) {
+		if (herodotus_read_codepoint(&(cr->r), true, &tmp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			return false;
+		}
+		cr->foldedlen = fold_codepoint(tmp, cr->folded);
+		cr->foldedoff = 0;
+	}
+	*cp = cr->folded[cr->foldedoff++];
+
+	return true;
+}
+
+static inline void
+caseless_skip_ascii(struct caseless_reader *a, struct caseless_reader *b)
+{
+	const void *awindow, *bwindow;
+	const unsigned char *asrc, *bsrc;
+	size_t alen, blen, len, i;
+	uint_least64_t x, y;
+	bool anul, bnul;
+
+	/*
+	 * The folding of an ASCII character is its lowercase, which
+	 * allows us to skip equal runs of ASCII characters at the
+	 * same positions word by word, as long as there is no folded
+	 * codepoint pending and the input lengths are known.
+	 */
+	if (a->foldedoff != a->foldedlen || b->foldedoff != b->foldedlen) {
+		return;
+	}
+	alen = herodotus_reader_window(&(a->r), HERODOTUS_TYPE_UTF8, &awindow,
+	                               &anul);
+	blen = herodotus_reader_window(&(b->r), HERODOTUS_TYPE_UTF8, &bwindow,
+	                               &bnul);
+	if (anul || bnul) {
+		return;
+	}
+	asrc = awindow;
+	bsrc = bwindow;
+	len = MIN(alen, blen);
+
+	for (i = 0; len - i >= 8; i += 8) {
+		x = ascii_word_load(asrc + i);
+		y = ascii_word_load(bsrc + i);
+		if (((x | y) & ASCII_WORD(0x80)) ||
+		    ascii_word_to_case(x, 'A', 'Z') !=
+		            ascii_word_to_case(y, 'A', 'Z')) {
+			/* leave the words to the codepoint-wise comparison */
+			break;
+		}
+	}
+	herodotus_reader_advance(&(a->r), i);
+	herodotus_reader_advance(&(b->r), i);
+}
+
+static int
+caseless_compare(struct caseless_reader *a, struct caseless_reader *b)
+{
+	uint_least32_t acp, bcp;
+	bool aread, bread;
+
+	a->foldedlen = a->foldedoff = 0;
+	b->foldedlen = b->foldedoff = 0;
+
+	for (;;) {
+		caseless_skip_ascii(a, b);
+
+		aread = caseless_read_codepoint(a, &acp);
+		bread = caseless_read_codepoint(b, &bcp);
+
+		if (!aread || !bread) {
+			/* a string that ended first is smaller */
+			return (int)aread - (int)bread;
+		} else if (acp != bcp) {
+			return (acp < bcp) ? -1 : 1;
+		}
+	}
+}
+
+int
+grapheme_caseless_compare(const uint_least32_t *a, size_t alen,
+                          const uint_least32_t *b, size_t blen)
+{
+	struct caseless_reader ar, br;
+
+	herodotus_reader_init(&(ar.r), HERODOTUS_TYPE_CODEPOINT, a, alen);
+	herodotus_reader_init(&(br.r), HERODOTUS_TYPE_CODEPOINT, b, blen);
+
+	return caseless_compare(&ar, &br);
+}
+
+int
+grapheme_caseless_compare_utf8(const char *a, size_t alen, const char *b,
+                               size_t blen)
+{
+	struct caseless_reader ar, br;
+
+	herodotus_reader_init(&(ar.r), HERODOTUS_TYPE_UTF8, a, alen);
+	herodotus_reader_init(&(br.r), HERODOTUS_TYPE_UTF8, b, blen);
+
+	return caseless_compare(&ar, &br);
+}
+
+/*
+ * The caseless hash is computed over the UTF-8-encoding of the case
+ * folding, which makes it independent of the input encoding. The bytes
+ * are little-endian-packed into 64-bit words, each of which is mixed
+ * into the state with a rotation, an XOR and a multiplication. The
+ * length is mixed in and the bits are avalanched at the end.
+ */
+struct caseless_hash {
+	uint_least64_t state;
+	uint_least64_t pending;
+	size_t len;
+};
+
+static inline void
+caseless_hash_mix(struct caseless_hash *h, uint_least64_t x)
+{
+	h->state = ((h->state << 5 | h->state >> 59) ^ x) *
+	           UINT64_C(0x9E3779B97F4A7C15);
+}
+
+static inline void
+caseless_hash_feed(struct caseless_hash *h, uint_least64_t x, size_t n)
+{
+	size_t used = h->len % 8;
+
+	/* x contains n <= 8 bytes and is zero above them */
+	h->pending |= x << (8 * used);
+	if (used + n >= 8) {
+		caseless_hash_mix(h, h->pending);
+		h->pending = (used == 0) ? 0 : x >> (8 * (8 - used));
+	}
+	h->len += n;
+}
+
+static inline void
+caseless_hash_feed_codepoint(struct caseless_hash *h, uint_least32_t cp)
+{
+	uint_least32_t folded[CASE_FOLDING_MAX];
+	uint_least64_t x;
+	size_t foldedlen, i, j, n;
+	char buf[4];
+
+	foldedlen = fold_codepoint(cp, folded);
+	for (i = 0; i < foldedlen; i++) {
+		n = grapheme_encode_utf8(folded[i], buf, LEN(buf));
+		for (j = 0, x = 0; j < n; j++) {
+			x |= (uint_least64_t)(unsigned char)buf[j] << (8 * j);
+		}
+		caseless_hash_feed(h, x, n);
+	}
+}
+
+static uint_least64_t
+caseless_hash(HERODOTUS_READER *r, uint_least64_t seed)
+{
+	struct caseless_hash h = {
+		.state = seed ^ UINT64_C(0x243F6A8885A308D3),
+		.pending = 0,
+		.len = 0,
+	};
+	const void *window;
+	const unsigned char *src;
+	size_t len, i;
+	uint_least64_t x;
+	uint_least32_t cp;
+	bool nul_terminated;
+
+	for (;;) {
+		/* hash runs of ASCII characters word by word */
+		len = herodotus_reader_window(r, HERODOTUS_TYPE_UTF8, &window,
+		                              &nul_terminated);
+		if (!nul_terminated) {
+			src = window;
+			for (i = 0; len - i >= 8; i += 8) {
+				x = ascii_word_load(src + i);
+				if (x & ASCII_WORD(0x80)) {
+					break;
+				}
+				caseless_hash_feed(
+					&h, ascii_word_to_case(x, 'A', 'Z'),
+					8);
+			}
+			herodotus_reader_advance(r, i);
+		}
+		if (herodotus_read_codepoint(r, true, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+		caseless_hash_feed_codepoint(&h, cp);
+	}
+
+	/* mix in the remaining bytes and the length and finalize */
+	caseless_hash_mix(&h, h.pending);
+	x = h.state ^ (uint_least64_t)h.len;
+	x = (x ^ (x >> 33)) * UINT64_C(0xFF51AFD7ED558CCD);
+	x = (x ^ (x >> 33)) * UINT64_C(0xC4CEB9FE1A85EC53);
+
+	return x ^ (x >> 33);
+}
+
+uint_least64_t
+grapheme_caseless_hash(const uint_least32_t *str, size_t len,
+                       uint_least64_t seed)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, str, len);
+
+	return caseless_hash(&r, seed);
+}
+
+uint_least64_t
+grapheme_caseless_hash_utf8(const char *str, size_t len, uint_least64_t seed)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, str, len);
+
+	return caseless_hash(&r, seed);
+}
+
+static inline void
+is_case_ascii(HERODOTUS_READER *r, bool lower)
+{
+	const void *window;
+	const uint_least32_t *cp;
+	const unsigned char *src;
+	unsigned char first, last;
+	size_t len, i;
+	uint_least64_t x;
+	bool nul_terminated;
+
+	/*
+	 * We skip the run of ASCII characters at the reader position
+	 * that already have the case, which are all but the latin
+	 * letters of the other case, without looking up their mapping.
+	 * The reader stops at the first character it cannot skip and
+	 * leaves it to the table lookup.
+	 */
+	if (lower) {
+		first = 'A';
+		last = 'Z';
+	} else {
+		first = 'a';
+		last = 'z';
+	}
+
+	i = 0;
+	if ((len = herodotus_reader_window(r, HERODOTUS_TYPE_CODEPOINT,
+	                                   &window, &nul_terminated)) > 0) {
+		cp = window;
+
+		for (; i < len && cp[i] < 0x80 &&
+		       (cp[i] < first || cp[i] > last);
+		     i++) {
+			if (cp[i] == 0 && nul_terminated) {
+				/* leave the terminating NUL to the reader */
+				break;
+			}
+		}
+	} else if ((len = herodotus_reader_window(r, HERODOTUS_TYPE_UTF8,
+	                                          &window,
+	                                          &nul_terminated)) > 0) {
+		src = window;
+
+		if (!nul_terminated) {
+			/*
+			 * We know the length of the input, which allows
+			 * us to check words without having to look out
+			 * for a terminating NUL-byte.
+			 */
+			for (; len - i >= 8; i += 8) {
+				x = ascii_word_load(src + i);
+				if ((x & ASCII_WORD(0x80)) ||
+				    ascii_word_in_range(x, first, last)) {
+					/*
+					 * there is a non-ASCII byte or a
+					 * letter of the other case
+					 */
+					break;
+				}
+			}
+		}
+		for (; i < len && src[i] < 0x80 &&
+		       (src[i] < first || src[i] > last);
+		     i++) {
+			if (src[i] == '\0' && nul_terminated) {
+				/* leave the NUL-byte to the reader */
+				break;
+			}
+		}
+	}
+
+	herodotus_reader_advance(r, i);
+}
+
 static inline bool
-is_case(HERODOTUS_READER *r, const uint_least16_t *major,
-        const int_least32_t *minor, const struct special_case *sc,
-        size_t *output)
+is_case(HERODOTUS_READER *r, const int_least32_t *offset,
+        const struct special_case *sc, size_t *output)
 {
 	size_t off, i;
 	bool ret = true;
 	uint_least32_t cp;
 	int_least32_t map;
 
-	for (; herodotus_read_codepoint(r, false, &cp) ==
-	       HERODOTUS_STATUS_SUCCESS;) {
+	for (;;) {
+		is_case_ascii(r, sc == lower_special);
+		if (herodotus_read_codepoint(r, false, &cp) !=
+		    HERODOTUS_STATUS_SUCCESS) {
+			break;
+		}
+
 		/* get and handle case mapping */
-		if (unlikely((map = get_case_offset(cp, major, minor)) >=
+		if (unlikely((map = get_case_offset(cp, offset)) >=
 		             INT32_C(0x110000))) {
 			/* we have a special case and the offset in the sc-array
 			 * is the difference to 0x110000*/
@@ -368,13 +1190,16 @@ done:
 static inline bool
 is_titlecase(HERODOTUS_READER *r, size_t *output)
 {
+	struct word_break_iterator it;
 	enum case_property prop;
 	enum herodotus_status s;
 	bool ret = true;
-	uint_least32_t cp;
+	uint_least32_t cp, mapped[CASE_MAPPING_MAX];
 	size_t nwb;
 
-	for (; (nwb = herodotus_next_word_break(r)) > 0;) {
+	word_break_iterator_init(&it, r);
+
+	for (; (nwb = word_break_iterator_next(&it)) > 0;) {
 		herodotus_reader_push_advance_limit(r, nwb);
 		for (; (s = herodotus_read_codepoint(r, false, &cp)) ==
 		       HERODOTUS_STATUS_SUCCESS;) {
@@ -404,20 +1229,18 @@ is_titlecase(HERODOTUS_READER *r, size_t *output)
 			 * we encountered a cased character before the word
 			 * break, check if it's titlecase
 			 */
-			herodotus_reader_push_advance_limit(
-				r, herodotus_reader_next_codepoint_break(r));
-			if (!is_case(r, title_major, title_minor, title_special,
-			             NULL)) {
+			if (map_codepoint(cp, title_offset, title_special,
+			                  mapped) == 0 ||
+			    mapped[0] != cp) {
 				ret = false;
 				goto done;
 			}
-			herodotus_reader_pop_limit(r);
+			herodotus_read_codepoint(r, true, &cp);
 		}
 
 		/* check if the rest of the codepoints in the word are lowercase
 		 */
-		if (!is_case(r, lower_major, lower_minor, lower_special,
-		             NULL)) {
+		if (!is_case(r, lower_offset, lower_special, NULL)) {
 			ret = false;
 			goto done;
 		}
@@ -439,7 +1262,7 @@ grapheme_is_uppercase(const uint_least32_t *src, size_t srclen, size_t *caselen)
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
 
-	return is_case(&r, upper_major, upper_minor, upper_special, caselen);
+	return is_case(&r, upper_offset, upper_special, caselen);
 }
 
 bool
@@ -449,7 +1272,7 @@ grapheme_is_lowercase(const uint_least32_t *src, size_t srclen, size_t *caselen)
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, src, srclen);
 
-	return is_case(&r, lower_major, lower_minor, lower_special, caselen);
+	return is_case(&r, lower_offset, lower_special, caselen);
 }
 
 bool
@@ -469,7 +1292,7 @@ grapheme_is_uppercase_utf8(const char *src, size_t srclen, size_t *caselen)
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
 
-	return is_case(&r, upper_major, upper_minor, upper_special, caselen);
+	return is_case(&r, upper_offset, upper_special, caselen);
 }
 
 bool
@@ -479,7 +1302,7 @@ grapheme_is_lowercase_utf8(const char *src, size_t srclen, size_t *caselen)
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, src, srclen);
 
-	return is_case(&r, lower_major, lower_minor, lower_special, caselen);
+	return is_case(&r, lower_offset, lower_special, caselen);
 }
 
 bool
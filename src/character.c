@@ -254,8 +254,9 @@ get_break_prop(uint_least32_t cp)
 {
 	if (likely(cp <= UINT32_C(0x10FFFF))) {
 		return (enum char_break_property)
-			char_break_minor[char_break_major[cp >> 8] +
-		                         (cp & 0xFF)];
+			segment_data[segment_minor[segment_major[cp >> 8] +
+		                                   (cp & 0xff)]]
+				.char_break;
 	} else {
 		return CHAR_BREAK_PROP_OTHER;
 	}
@@ -3,23 +3,134 @@
 #include <stddef.h>
 
 #include "../gen/line.h"
+#include "../gen/width.h"
 #include "../grapheme.h"
 #include "util.h"
 
+/*
+ * The measure is an optional companion of the line breaker that
+ * accounts for every codepoint the breaker consumes, such that the
+ * wrapper gets the display width of a segment between two break
+ * opportunities (and the cluster boundaries within it) in the same
+ * pass over the input.
+ */
+struct line_measure {
+	size_t off;           /* offset after the last measured codepoint */
+	size_t start;         /* offset of the segment start */
+	size_t limit;         /* number of available columns */
+	size_t width;         /* line width including the segment so far */
+	size_t content_width; /* line width without hanging codepoints */
+	size_t content_off;   /* offset after the last non-hanging cp */
+	size_t fit_off;       /* last cluster boundary within the limit */
+	size_t fit_width;     /* line width up to fit_off */
+	uint_least32_t last_cp;
+	uint_least16_t char_break_state;
+	uint_least8_t cluster_width;
+	bool mandatory;
+};
+
 static inline enum line_break_property
 get_break_prop(uint_least32_t cp)
 {
 	if (likely(cp <= UINT32_C(0x10FFFF))) {
 		return (enum line_break_property)
-			line_break_minor[line_break_major[cp >> 8] +
-		                         (cp & 0xff)];
+			segment_data[segment_minor[segment_major[cp >> 8] +
+		                                   (cp & 0xff)]]
+				.line_break;
 	} else {
 		return LINE_BREAK_PROP_AL;
 	}
 }
 
+static inline uint_least8_t
+get_width(uint_least32_t cp)
+{
+	enum width_property prop;
+
+	if (likely(cp <= UINT32_C(0x10FFFF))) {
+		prop = (enum width_property)
+			width_minor[width_major[cp >> 8] + (cp & 0xff)];
+	} else {
+		prop = WIDTH_PROP_NARROW;
+	}
+
+	return (prop == WIDTH_PROP_ZERO) ? 0 :
+	       (prop == WIDTH_PROP_WIDE) ? 2 :
+	                                   1;
+}
+
+static void
+line_measure_init(struct line_measure *m, size_t off, size_t width,
+                  size_t limit)
+{
+	m->off = m->start = m->content_off = m->fit_off = off;
+	m->limit = limit;
+	m->width = m->content_width = m->fit_width = width;
+	m->last_cp = 0;
+	m->char_break_state = 0;
+	m->cluster_width = 0;
+	m->mandatory = false;
+}
+
+static inline void
+line_measure_codepoint(struct line_measure *m, const HERODOTUS_READER *r,
+                       uint_least32_t cp, enum line_break_property prop)
+{
+	size_t off = herodotus_reader_number_read(r);
+	uint_least8_t width;
+
+	if (m == NULL || off == m->off) {
+		/* nothing to measure or nothing has been consumed */
+		return;
+	}
+
+	if (m->off == m->start ||
+	    grapheme_is_character_break(m->last_cp, cp,
+	                                &(m->char_break_state))) {
+		/*
+		 * we are at a cluster boundary: remember it if the clusters
+		 * before it still fit into the line, but always take at
+		 * least one cluster to guarantee progress
+		 */
+		if (m->off > m->start &&
+		    (m->width <= m->limit || m->fit_off == m->start)) {
+			m->fit_off = m->off;
+			m->fit_width = m->width;
+		}
+		m->cluster_width = 0;
+	}
+
+	/*
+	 * a cluster is as wide as its widest codepoint (which handles
+	 * combining marks, emoji zwj-sequences and conjoining jamo
+	 * alike), and a variation selector 16 requests the wide
+	 * emoji presentation
+	 */
+	width = (cp == UINT32_C(0xFE0F)) ? 2 : get_width(cp);
+	if (width > m->cluster_width) {
+		m->width += width - m->cluster_width;
+		m->cluster_width = width;
+	}
+
+	/*
+	 * spaces at the end of a line hang (i.e. they don't contribute
+	 * to its width), as do the mandatory break characters
+	 */
+	m->mandatory = (prop == LINE_BREAK_PROP_BK ||
+	                prop == LINE_BREAK_PROP_CR ||
+	                prop == LINE_BREAK_PROP_LF ||
+	                prop == LINE_BREAK_PROP_NL);
+	if (prop != LINE_BREAK_PROP_SP && !m->mandatory) {
+		m->content_width = m->width;
+		m->content_off = off;
+	}
+
+	m->last_cp = cp;
+	m->off = off;
+}
+
 static size_t
-next_line_break(HERODOTUS_READER *r)
+next_line_break(HERODOTUS_READER *r, struct line_measure *m)
 {
 	HERODOTUS_READER tmp;
 	enum line_break_property cp0_prop, cp1_prop, last_non_cm_or_zwj_prop,
@@ -45,10 +156,12 @@ next_line_break(HERODOTUS_READER *r)
 	last_non_sp_prop = last_non_sp_cm_or_zwj_prop = NUM_LINE_BREAK_PROPS;
 
 	for (herodotus_read_codepoint(r, true, &cp),
-	     cp0_prop = get_break_prop(cp);
+	     cp0_prop = get_break_prop(cp),
+	     line_measure_codepoint(m, r, cp, cp0_prop);
 	     herodotus_read_codepoint(r, false, &cp) ==
 	     HERODOTUS_STATUS_SUCCESS;
-	     herodotus_read_codepoint(r, true, &cp), cp0_prop = cp1_prop) {
+	     herodotus_read_codepoint(r, true, &cp), cp0_prop = cp1_prop,
+	     line_measure_codepoint(m, r, cp, cp0_prop)) {
 		/* get property of the right codepoint */
 		cp1_prop = get_break_prop(cp);
 
@@ -508,7 +621,7 @@ grapheme_next_line_break(const uint_least32_t *str, size_t len)
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, str, len);
 
-	return next_line_break(&r);
+	return next_line_break(&r, NULL);
 }
 
 size_t
@@ -518,5 +631,514 @@ grapheme_next_line_break_utf8(const char *str, size_t len)
 
 	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, str, len);
 
-	return next_line_break(&r);
+	return next_line_break(&r, NULL);
+}
+
+size_t
+wrap_line(HERODOTUS_READER *r, size_t columns, size_t *linelen)
+{
+	struct line_measure m;
+	size_t begin, start, off, width = 0, visible_off;
+	bool empty = true;
+
+	begin = visible_off = herodotus_reader_number_read(r);
+
+	/*
+	 * Greedily fill the line with the segments between the line
+	 * break opportunities, measuring each segment while the line
+	 * breaker consumes it.
+	 */
+	for (;;) {
+		start = herodotus_reader_number_read(r);
+		line_measure_init(&m, start, width, columns);
+
+		if ((off = next_line_break(r, &m)) == start) {
+			/* we reached the end of the input */
+			break;
+		}
+
+		if (m.content_width > columns) {
+			if (!empty) {
+				/* the segment begins the next line */
+				off = start;
+				break;
+			}
+			if (m.fit_off > start && m.fit_off < m.content_off) {
+				/*
+				 * the segment is too wide for a line of its
+				 * own, so we break it at the last grapheme
+				 * cluster boundary that still fits
+				 */
+				visible_off = off = m.fit_off;
+				break;
+			}
+		}
+
+		/* the segment fits into the line */
+		width = m.width;
+		visible_off = m.content_off;
+		empty = false;
+
+		if (m.mandatory) {
+			break;
+		}
+	}
+
+	if (linelen != NULL) {
+		*linelen = visible_off - begin;
+	}
+
+	return off;
+}
+
+size_t
+grapheme_wrap_line(const uint_least32_t *str, size_t len, size_t columns,
+                   size_t *linelen)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, str, len);
+
+	return wrap_line(&r, columns, linelen);
+}
+
+size_t
+grapheme_wrap_line_utf8(const char *str, size_t len, size_t columns,
+                        size_t *linelen)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, str, len);
+
+	return wrap_line(&r, columns, linelen);
+}
+
+/*
+ * For the optimal wrapping, the caller-provided buffer is used as
+ * an array of records, one for each line break opportunity (i.e.
+ * possible line end) of the paragraph and one for its beginning.
+ */
+enum wrap_record_field {
+	WRAP_RECORD_OFFSET,        /* offset of the opportunity */
+	WRAP_RECORD_WIDTH,         /* width of the text before it */
+	WRAP_RECORD_CONTENT_WIDTH, /* the same without hanging codepoints */
+	WRAP_RECORD_COST,          /* minimum cost of a break here */
+	WRAP_RECORD_PREDECESSOR,   /* the line beginning for this cost */
+	WRAP_RECORD_QUEUE_CANDIDATE,
+	WRAP_RECORD_QUEUE_START,
+	NUM_WRAP_RECORD_FIELDS,
+};
+
+#define WRAP_RECORD(buf, i, field) \
+	((buf)[(i) * NUM_WRAP_RECORD_FIELDS + (field)])
+
+static size_t
+wrap_cost(const size_t *buf, size_t columns, size_t i, size_t j)
+{
+	size_t width, slack, cost;
+
+	/*
+	 * The cost of a line from opportunity i to opportunity j is
+	 * the square of its slack added to the cost of a break at i.
+	 * As a function of the width this is convex, which makes the
+	 * cost satisfy the quadrangle inequality.
+	 */
+	width = WRAP_RECORD(buf, j, WRAP_RECORD_CONTENT_WIDTH) -
+	        WRAP_RECORD(buf, i, WRAP_RECORD_WIDTH);
+	if (width > columns) {
+		return SIZE_MAX;
+	}
+	slack = columns - width;
+	cost = (slack != 0 && slack > SIZE_MAX / slack) ? SIZE_MAX :
+	                                                  slack * slack;
+
+	return (cost > SIZE_MAX - WRAP_RECORD(buf, i, WRAP_RECORD_COST)) ?
+	               SIZE_MAX :
+	               cost + WRAP_RECORD(buf, i, WRAP_RECORD_COST);
+}
+
+static size_t
+wrap_paragraph(HERODOTUS_READER *r, size_t columns, size_t *buf,
+               size_t buflen)
+{
+	struct line_measure m;
+	size_t i, j, n, start, off, width, head, tail, last, lo, hi, mid;
+
+	/*
+	 * every line holds at least one grapheme cluster, which would
+	 * not hold for zero columns given the clamping below
+	 */
+	columns = MAX(columns, 1);
+
+	/* the beginning of the paragraph */
+	if (buflen >= NUM_WRAP_RECORD_FIELDS) {
+		WRAP_RECORD(buf, 0, WRAP_RECORD_OFFSET) = 0;
+		WRAP_RECORD(buf, 0, WRAP_RECORD_WIDTH) = 0;
+		WRAP_RECORD(buf, 0, WRAP_RECORD_CONTENT_WIDTH) = 0;
+		WRAP_RECORD(buf, 0, WRAP_RECORD_COST) = 0;
+	}
+
+	/*
+	 * Collect the line break opportunities up to the end of the
+	 * paragraph (i.e. the first mandatory break), splitting
+	 * segments that are too wide for a line of their own at the
+	 * last fitting grapheme cluster boundary like the greedy
+	 * wrapper does. If the buffer is too small, we only count
+	 * them to determine the required buffer length.
+	 */
+	for (n = 0, width = 0;;) {
+		start = herodotus_reader_number_read(r);
+		line_measure_init(&m, start, 0, columns);
+
+		if ((off = next_line_break(r, &m)) == start) {
+			/* we reached the end of the input */
+			break;
+		}
+
+		if (m.content_width > columns) {
+			if (m.fit_off > start && m.fit_off < m.content_off) {
+				/* continue reading after the fitting part */
+				off = m.fit_off;
+				herodotus_reader_seek(r, off);
+				m.width = m.content_width = m.fit_width;
+				m.mandatory = false;
+			} else {
+				/*
+				 * the segment is a single grapheme cluster
+				 * that is too wide, which we let fill the
+				 * line exactly such that there always is a
+				 * solution
+				 */
+				m.width -= m.content_width - columns;
+				m.content_width = columns;
+			}
+		}
+
+		n++;
+		if ((n + 1) * NUM_WRAP_RECORD_FIELDS <= buflen) {
+			WRAP_RECORD(buf, n, WRAP_RECORD_OFFSET) = off;
+			WRAP_RECORD(buf, n, WRAP_RECORD_CONTENT_WIDTH) =
+				width + m.content_width;
+			WRAP_RECORD(buf, n, WRAP_RECORD_WIDTH) =
+				width + m.width;
+		}
+		width += m.width;
+
+		if (m.mandatory) {
+			break;
+		}
+	}
+	if (n == 0) {
+		return 0;
+	} else if ((n + 1) * NUM_WRAP_RECORD_FIELDS > buflen) {
+		/* the buffer is too small, return the required length */
+		return (n + 1) * NUM_WRAP_RECORD_FIELDS;
+	}
+
+	/*
+	 * Determine the minimum cost of a break at each opportunity.
+	 * Given the quadrangle inequality, the best line beginning
+	 * never moves backwards for later opportunities, and we keep
+	 * the candidates in a queue, each with the first opportunity
+	 * where it becomes the best one, yielding O(n log n) time.
+	 */
+	WRAP_RECORD(buf, 0, WRAP_RECORD_QUEUE_CANDIDATE) = 0;
+	WRAP_RECORD(buf, 0, WRAP_RECORD_QUEUE_START) = 1;
+	for (j = 1, head = 0, tail = 1; j < n; j++) {
+		/* drop the candidates whose time has passed */
+		while (tail - head >= 2 &&
+		       WRAP_RECORD(buf, head + 1, WRAP_RECORD_QUEUE_START) <=
+		               j) {
+			head++;
+		}
+
+		i = WRAP_RECORD(buf, head, WRAP_RECORD_QUEUE_CANDIDATE);
+		WRAP_RECORD(buf, j, WRAP_RECORD_COST) =
+			wrap_cost(buf, columns, i, j);
+		WRAP_RECORD(buf, j, WRAP_RECORD_PREDECESSOR) = i;
+
+		/* insert j as a candidate for the following breaks */
+		for (lo = j + 1; tail > head;) {
+			last = WRAP_RECORD(buf, tail - 1,
+			                   WRAP_RECORD_QUEUE_CANDIDATE);
+			lo = MAX(WRAP_RECORD(buf, tail - 1,
+			                     WRAP_RECORD_QUEUE_START),
+			         j + 1);
+
+			if (wrap_cost(buf, columns, j, lo) <=
+			    wrap_cost(buf, columns, last, lo)) {
+				/* j is always better than the last one */
+				tail--;
+				continue;
+			}
+
+			/* search the first break where j is better */
+			for (lo++, hi = n; lo < hi;) {
+				mid = lo + (hi - lo) / 2;
+				if (wrap_cost(buf, columns, j, mid) <=
+				    wrap_cost(buf, columns, last, mid)) {
+					hi = mid;
+				} else {
+					lo = mid + 1;
+				}
+			}
+			break;
+		}
+		if (tail == head) {
+			/* j is the only candidate left */
+			lo = j + 1;
+		}
+		if (lo < n) {
+			WRAP_RECORD(buf, tail, WRAP_RECORD_QUEUE_CANDIDATE) = j;
+			WRAP_RECORD(buf, tail, WRAP_RECORD_QUEUE_START) = lo;
+			tail++;
+		}
+	}
+
+	/*
+	 * the last line has no cost, so we pick the cheapest fitting
+	 * beginning, preferring fewer lines
+	 */
+	for (i = n - 1, last = n - 1; i-- > 0;) {
+		if (WRAP_RECORD(buf, n, WRAP_RECORD_CONTENT_WIDTH) -
+		            WRAP_RECORD(buf, i, WRAP_RECORD_WIDTH) >
+		    columns) {
+			break;
+		}
+		if (WRAP_RECORD(buf, i, WRAP_RECORD_COST) <=
+		    WRAP_RECORD(buf, last, WRAP_RECORD_COST)) {
+			last = i;
+		}
+	}
+	WRAP_RECORD(buf, n, WRAP_RECORD_PREDECESSOR) = last;
+
+	/*
+	 * Store the chosen line ends in order in the (no longer needed)
+	 * queue fields, and finally write their offsets to the front of
+	 * the buffer. Each line contains at least one opportunity, so
+	 * we only ever overwrite records that have already been read.
+	 */
+	for (i = n, j = 0; i > 0;
+	     i = WRAP_RECORD(buf, i, WRAP_RECORD_PREDECESSOR)) {
+		j++;
+	}
+	for (i = n, lo = j; i > 0;
+	     i = WRAP_RECORD(buf, i, WRAP_RECORD_PREDECESSOR)) {
+		WRAP_RECORD(buf, --lo, WRAP_RECORD_QUEUE_CANDIDATE) = i;
+	}
+	for (i = 0; i < j; i++) {
+		buf[i] = WRAP_RECORD(
+			buf, WRAP_RECORD(buf, i, WRAP_RECORD_QUEUE_CANDIDATE),
+			WRAP_RECORD_OFFSET);
+	}
+
+	return j;
+}
+
+size_t
+grapheme_wrap_paragraph(const uint_least32_t *str, size_t len, size_t columns,
+                        size_t *buf, size_t buflen)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, str, len);
+
+	return wrap_paragraph(&r, columns, buf, buflen);
+}
+
+size_t
+grapheme_wrap_paragraph_utf8(const char *str, size_t len, size_t columns,
+                             size_t *buf, size_t buflen)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, str, len);
+
+	return wrap_paragraph(&r, columns, buf, buflen);
+}
+
+/*
+ * For the incremental wrapping, the caller-provided buffer holds one
+ * record per line, the checkpoints. Given the wrapping of a line only
+ * depends on the text after its beginning, it is enough to remember
+ * how far the wrapper has read ahead (including the lookahead of at
+ * most two codepoints of the line breaker), which we keep as a running
+ * maximum such that it is monotonic.
+ */
+enum wrap_line_record_field {
+	WRAP_LINE_RECORD_END,    /* offset of the line end */
+	WRAP_LINE_RECORD_EXTENT, /* offset up to which the text was read */
+	NUM_WRAP_LINE_RECORD_FIELDS,
+};
+
+#define WRAP_LINE_RECORD(buf, i, field) \
+	((buf)[(i) * NUM_WRAP_LINE_RECORD_FIELDS + (field)])
+
+#define WRAP_LOOKAHEAD 8
+
+static size_t
+wrap_line_at(enum herodotus_type type, const void *str, size_t len,
+             size_t off, size_t columns, size_t *extent)
+{
+	HERODOTUS_READER r;
+	size_t end, read;
+
+	herodotus_reader_init(&r, type, str, len);
+	herodotus_reader_seek(&r, off);
+
+	end = wrap_line(&r, columns, NULL);
+	read = herodotus_reader_number_read(&r);
+	*extent = MAX(*extent, (read > SIZE_MAX - WRAP_LOOKAHEAD) ?
+	                               SIZE_MAX :
+	                               read + WRAP_LOOKAHEAD);
+
+	return end;
+}
+
+static size_t
+wrap_update(enum herodotus_type type, const void *str, size_t len,
+            size_t columns, size_t off, size_t oldlen, size_t newlen,
+            size_t *buf, size_t buflen, size_t nlines)
+{
+	size_t cap, total, i, j, k, c, lo, hi, cur, end, extent, last_extent,
+		deferred, deferred_start, deferred_extent;
+	bool converged = false;
+
+	cap = (buf == NULL) ? 0 : buflen / NUM_WRAP_LINE_RECORD_FIELDS;
+	total = nlines;
+	nlines = MIN(nlines, cap);
+
+	/*
+	 * find the first line whose wrapping might have read the
+	 * edited text, all lines before it are unaffected
+	 */
+	for (lo = 0, hi = nlines; lo < hi;) {
+		i = lo + (hi - lo) / 2;
+		if (WRAP_LINE_RECORD(buf, i, WRAP_LINE_RECORD_EXTENT) > off) {
+			hi = i;
+		} else {
+			lo = i + 1;
+		}
+	}
+	i = lo;
+	if (i == 0) {
+		cur = extent = 0;
+	} else {
+		cur = WRAP_LINE_RECORD(buf, i - 1, WRAP_LINE_RECORD_END);
+		extent = WRAP_LINE_RECORD(buf, i - 1, WRAP_LINE_RECORD_EXTENT);
+	}
+
+	/*
+	 * Rewrap from there until a line ends behind the edit where an
+	 * old line ended, after which everything stays the same. We
+	 * store the new lines right away unless we would overwrite old
+	 * lines that we still need, in which case we defer it.
+	 */
+	deferred = SIZE_MAX;
+	deferred_start = deferred_extent = 0;
+	for (j = i, c = 0; !converged; c++, cur = end) {
+		k = i + c;
+		last_extent = extent;
+
+		if ((end = wrap_line_at(type, str, len, cur, columns,
+		                        &extent)) == cur) {
+			/* we reached the end of the text */
+			break;
+		}
+
+		if (end >= off + newlen) {
+			/* compare with the old line ends behind the edit */
+			for (; j < nlines &&
+			       WRAP_LINE_RECORD(buf, j, WRAP_LINE_RECORD_END) <
+			               end - newlen + oldlen;
+			     j++) {
+				;
+			}
+			converged = (j < nlines &&
+			             WRAP_LINE_RECORD(buf, j,
+			                              WRAP_LINE_RECORD_END) ==
+			                     end - newlen + oldlen);
+		}
+
+		if (deferred == SIZE_MAX && k < cap) {
+			if (k < j || k >= nlines || (converged && k == j)) {
+				WRAP_LINE_RECORD(buf, k, WRAP_LINE_RECORD_END) =
+					end;
+				WRAP_LINE_RECORD(buf, k,
+				                 WRAP_LINE_RECORD_EXTENT) = extent;
+			} else {
+				deferred = k;
+				deferred_start = cur;
+				deferred_extent = last_extent;
+			}
+		}
+	}
+
+	if (converged) {
+		/*
+		 * move the old lines behind the converged one to their
+		 * new place, going backwards if they move forwards
+		 */
+		for (lo = 0; lo < nlines - (j + 1); lo++) {
+			k = (i + c < j + 1) ? j + 1 + lo : nlines - 1 - lo;
+			if (k - (j + 1) + i + c >= cap) {
+				continue;
+			}
+			WRAP_LINE_RECORD(buf, k - (j + 1) + i + c,
+			                 WRAP_LINE_RECORD_END) =
+				WRAP_LINE_RECORD(buf, k, WRAP_LINE_RECORD_END) -
+				oldlen + newlen;
+			WRAP_LINE_RECORD(buf, k - (j + 1) + i + c,
+			                 WRAP_LINE_RECORD_EXTENT) =
+				MAX(extent, WRAP_LINE_RECORD(
+						    buf, k,
+						    WRAP_LINE_RECORD_EXTENT) -
+				                    oldlen + newlen);
+		}
+	}
+
+	/* store the deferred lines, now that the old ones are gone */
+	for (k = deferred, cur = deferred_start, extent = deferred_extent;
+	     k < MIN(i + c, cap); k++, cur = end) {
+		end = wrap_line_at(type, str, len, cur, columns, &extent);
+		WRAP_LINE_RECORD(buf, k, WRAP_LINE_RECORD_END) = end;
+		WRAP_LINE_RECORD(buf, k, WRAP_LINE_RECORD_EXTENT) = extent;
+	}
+
+	if (!converged) {
+		return i + c;
+	}
+
+	/*
+	 * if lines were removed and the old lines did not all fit into
+	 * the buffer, the freed records at its end are filled up
+	 */
+	for (k = i + c + nlines - (j + 1); k < MIN(i + c + total - (j + 1), cap);
+	     k++) {
+		cur = WRAP_LINE_RECORD(buf, k - 1, WRAP_LINE_RECORD_END);
+		extent = WRAP_LINE_RECORD(buf, k - 1, WRAP_LINE_RECORD_EXTENT);
+		end = wrap_line_at(type, str, len, cur, columns, &extent);
+		WRAP_LINE_RECORD(buf, k, WRAP_LINE_RECORD_END) = end;
+		WRAP_LINE_RECORD(buf, k, WRAP_LINE_RECORD_EXTENT) = extent;
+	}
+
+	return i + c + total - (j + 1);
+}
+
+size_t
+grapheme_wrap_update(const uint_least32_t *str, size_t len, size_t columns,
+                     size_t off, size_t oldlen, size_t newlen, size_t *buf,
+                     size_t buflen, size_t nlines)
+{
+	return wrap_update(HERODOTUS_TYPE_CODEPOINT, str, len, columns, off,
+	                   oldlen, newlen, buf, buflen, nlines);
+}
+
+size_t
+grapheme_wrap_update_utf8(const char *str, size_t len, size_t columns,
+                          size_t off, size_t oldlen, size_t newlen,
+                          size_t *buf, size_t buflen, size_t nlines)
+{
+	return wrap_update(HERODOTUS_TYPE_UTF8, str, len, columns, off, oldlen,
+	                   newlen, buf, buflen, nlines);
 }
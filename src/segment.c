@@ -0,0 +1,250 @@
+/* See LICENSE file for copyright and license details. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../grapheme.h"
+#include "util.h"
+
+/* the number of codepoints of a paragraph we decode at once */
+#define SEGMENT_CHUNK_LEN 1024
+
+static size_t (*const next_break[])(const uint_least32_t *, size_t) = {
+	grapheme_next_character_break,
+	grapheme_next_word_break,
+	grapheme_next_sentence_break,
+	grapheme_next_line_break,
+};
+
+static size_t (*const next_break_utf8[])(const char *, size_t) = {
+	grapheme_next_character_break_utf8,
+	grapheme_next_word_break_utf8,
+	grapheme_next_sentence_break_utf8,
+	grapheme_next_line_break_utf8,
+};
+
+static inline void
+add_segment(struct grapheme_segmentation *seg, size_t end)
+{
+	if (seg->ends != NULL && seg->count < seg->endslen) {
+		seg->ends[seg->count] = end;
+	}
+	seg->count++;
+}
+
+static inline bool
+is_paragraph_separator_codepoint(uint_least32_t cp)
+{
+	return cp == UINT32_C(0x000A) || cp == UINT32_C(0x000D) ||
+	       cp == UINT32_C(0x0085) || cp == UINT32_C(0x2028) ||
+	       cp == UINT32_C(0x2029);
+}
+
+static bool
+is_paragraph_separator(HERODOTUS_READER *r, uint_least32_t cp)
+{
+	uint_least32_t next;
+
+	/*
+	 * After a line feed, next line, line separator, paragraph
+	 * separator or a carriage return not followed by a line feed,
+	 * there is a break in all four segmentations (GB4, WB3a, SB4,
+	 * LB4/LB5) and none of them looks beyond it to decide on the
+	 * breaks before it.
+	 */
+	if (cp == UINT32_C(0x000D)) {
+		return herodotus_read_codepoint(r, false, &next) !=
+		               HERODOTUS_STATUS_SUCCESS ||
+		       next != UINT32_C(0x000A);
+	}
+
+	return is_paragraph_separator_codepoint(cp);
+}
+
+static bool
+ends_with_paragraph_separator(const void *src, size_t len, bool utf8)
+{
+	const uint_least32_t *cp = src;
+	const unsigned char *s = src;
+
+	/*
+	 * We only look at the input before a break, where a carriage
+	 * return cannot be followed by a line feed, as all
+	 * segmentations keep them together (GB3, WB3, SB3, LB5).
+	 * Given the decoder never takes a lead byte as part of the
+	 * sequence before it, the following byte sequences at the end
+	 * of the input always are the encodings of a paragraph
+	 * separator.
+	 */
+	if (!utf8) {
+		return len > 0 && is_paragraph_separator_codepoint(cp[len - 1]);
+	}
+
+	return (len >= 1 && (s[len - 1] == 0x0A || s[len - 1] == 0x0D)) ||
+	       (len >= 2 && s[len - 2] == 0xC2 && s[len - 1] == 0x85) ||
+	       (len >= 3 && s[len - 3] == 0xE2 && s[len - 2] == 0x80 &&
+	        (s[len - 1] == 0xA8 || s[len - 1] == 0xA9));
+}
+
+static size_t
+segment_paragraph_directly(HERODOTUS_READER *r, unsigned int segmentations,
+                           struct grapheme_segmentation *seg)
+{
+	const void *src;
+	uint_least32_t cp;
+	size_t start, len, off, n, i, end;
+	bool utf8, nul_terminated;
+
+	/*
+	 * Each segmentation reads the input at the reader position
+	 * until it hits a break after a paragraph separator or the end
+	 * of the input, which is where the paragraph ends for all of
+	 * them. The end of a NUL-terminated input is not known, which
+	 * is why we leave it to the break functions to find the NUL.
+	 */
+	start = herodotus_reader_number_read(r);
+	if ((len = herodotus_reader_window(r, HERODOTUS_TYPE_UTF8, &src,
+	                                   &nul_terminated)) > 0) {
+		utf8 = true;
+	} else if ((len = herodotus_reader_window(r, HERODOTUS_TYPE_CODEPOINT,
+	                                          &src,
+	                                          &nul_terminated)) > 0) {
+		utf8 = false;
+	} else {
+		return 0;
+	}
+
+	for (i = 0, end = SIZE_MAX; i < LEN(next_break); i++) {
+		if (!(segmentations & (1U << i))) {
+			continue;
+		}
+		for (off = 0;; off += n) {
+			if (utf8) {
+				n = next_break_utf8[i](
+					(const char *)src + off,
+					nul_terminated ? SIZE_MAX : len - off);
+			} else {
+				n = next_break[i](
+					(const uint_least32_t *)src + off,
+					nul_terminated ? SIZE_MAX : len - off);
+			}
+			if (n == 0) {
+				break;
+			}
+			add_segment(&seg[i], start + off + n);
+			if (ends_with_paragraph_separator(src, off + n,
+			                                  utf8)) {
+				off += n;
+				break;
+			}
+		}
+		end = off;
+	}
+
+	if (end == SIZE_MAX) {
+		/* no segmentation was requested, so we only find the end */
+		while (herodotus_read_codepoint(r, true, &cp) ==
+		               HERODOTUS_STATUS_SUCCESS &&
+		       !is_paragraph_separator(r, cp)) {
+			;
+		}
+
+		return herodotus_reader_number_read(r) - start;
+	}
+	herodotus_reader_seek(r, start + end);
+
+	return end;
+}
+
+static size_t
+segment(HERODOTUS_READER *r, unsigned int segmentations,
+        struct grapheme_segmentation *seg)
+{
+	uint_least32_t chunk[SEGMENT_CHUNK_LEN], cp;
+	uint_least16_t chunk_off[SEGMENT_CHUNK_LEN + 1];
+	const void *src;
+	size_t start, n, i, off;
+	bool chunked, nul_terminated;
+
+	for (i = 0; i < LEN(next_break); i++) {
+		if (segmentations & (1U << i)) {
+			seg[i].count = 0;
+		}
+	}
+
+	/*
+	 * The paragraph separators are breaks in all segmentations
+	 * that are independent of what follows them, which allows us
+	 * to segment the text paragraph by paragraph. A UTF-8-encoded
+	 * paragraph is decoded only once into a chunk of codepoints,
+	 * which all segmentations then work on. If it turns out to be
+	 * too long for the chunk, we stop decoding and let the
+	 * segmentations read the paragraph directly from where it
+	 * starts, as we do for codepoint input.
+	 */
+	for (;;) {
+		start = herodotus_reader_number_read(r);
+		chunked = herodotus_reader_window(r, HERODOTUS_TYPE_UTF8, &src,
+		                                  &nul_terminated) > 0;
+		for (n = 0, chunk_off[0] = 0;
+		     chunked && herodotus_read_codepoint(r, true, &cp) ==
+		                        HERODOTUS_STATUS_SUCCESS;) {
+			chunk[n++] = cp;
+			chunk_off[n] = (uint_least16_t)(
+				herodotus_reader_number_read(r) - start);
+			if (is_paragraph_separator(r, cp)) {
+				break;
+			} else if (n == SEGMENT_CHUNK_LEN) {
+				/* the paragraph does not fit */
+				chunked = false;
+			}
+		}
+
+		if (!chunked) {
+			herodotus_reader_seek(r, start);
+			if (segment_paragraph_directly(r, segmentations,
+			                               seg) == 0) {
+				break;
+			}
+			continue;
+		} else if (n == 0) {
+			/* we reached the end of the input */
+			break;
+		}
+
+		for (i = 0; i < LEN(next_break); i++) {
+			if (!(segmentations & (1U << i))) {
+				continue;
+			}
+			for (off = 0; off < n;) {
+				off += next_break[i](chunk + off, n - off);
+				add_segment(&seg[i], start + chunk_off[off]);
+			}
+		}
+	}
+
+	return herodotus_reader_number_read(r);
+}
+
+size_t
+grapheme_segment(const uint_least32_t *str, size_t len,
+                 unsigned int segmentations,
+                 struct grapheme_segmentation *seg)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_CODEPOINT, str, len);
+
+	return segment(&r, segmentations, seg);
+}
+
+size_t
+grapheme_segment_utf8(const char *str, size_t len, unsigned int segmentations,
+                      struct grapheme_segmentation *seg)
+{
+	HERODOTUS_READER r;
+
+	herodotus_reader_init(&r, HERODOTUS_TYPE_UTF8, str, len);
+
+	return segment(&r, segmentations, seg);
+}
@@ -16,8 +16,9 @@ get_sentence_break_prop(uint_least32_t cp)
 {
 	if (likely(cp <= UINT32_C(0x10FFFF))) {
 		return (uint_least8_t)
-			sentence_break_minor[sentence_break_major[cp >> 8] +
-		                             (cp & 0xff)];
+			segment_data[segment_minor[segment_major[cp >> 8] +
+		                                   (cp & 0xff)]]
+				.sentence_break;
 	} else {
 		return SENTENCE_BREAK_PROP_OTHER;
 	}
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "../gen/segment.h"
 #include "../gen/types.h"
 #include "../grapheme.h"
 #include "util.h"
@@ -128,6 +129,105 @@ herodotus_reader_number_read(const HERODOTUS_READER *r)
 	return r->off;
 }
 
+size_t
+herodotus_reader_window(const HERODOTUS_READER *r, enum herodotus_type type,
+                        const void **src, bool *nul_terminated)
+{
+	/*
+	 * The window holds the units that can be read at the reader
+	 * position before the end of the buffer or the soft limit is
+	 * reached. The end of a NUL-terminated buffer is not known
+	 * beforehand, so the caller has to look out for the NUL within
+	 * the window and must not read past it.
+	 */
+	*nul_terminated = (r->srclen == SIZE_MAX);
+	if (r->type != type || r->src == NULL || r->terminated_by_null ||
+	    r->off >= MIN(r->srclen, r->soft_limit[0])) {
+		*src = NULL;
+		return 0;
+	}
+
+	if (r->type == HERODOTUS_TYPE_CODEPOINT) {
+		*src = (const uint_least32_t *)(r->src) + r->off;
+	} else { /* r->type == HERODOTUS_TYPE_UTF8 */
+		*src = (const char *)(r->src) + r->off;
+	}
+
+	return MIN(r->srclen, r->soft_limit[0]) - r->off;
+}
+
+void
+herodotus_reader_advance(HERODOTUS_READER *r, size_t count)
+{
+	/* the count must not exceed the window */
+	r->off += count;
+}
+
+void
+herodotus_reader_seek(HERODOTUS_READER *r, size_t off)
+{
+	/*
+	 * The offset must not lie beyond the end of the buffer. If the
+	 * reader moves, a terminating NUL at the new offset is simply
+	 * encountered again with the next read.
+	 */
+	if (off != r->off) {
+		r->terminated_by_null = false;
+	}
+	r->off = off;
+}
+
+size_t
+herodotus_reader_skip_ascii(HERODOTUS_READER *r)
+{
+	const uint_least32_t *cp;
+	const unsigned char *src;
+	size_t len, i;
+
+	/*
+	 * We skip the run of ASCII characters at the reader position,
+	 * which stops at the first non-ASCII character or before the
+	 * terminating NUL. If the length of UTF-8-input is known, we
+	 * check a word of bytes at a time.
+	 */
+	if (r->src == NULL || r->terminated_by_null ||
+	    r->off >= MIN(r->srclen, r->soft_limit[0])) {
+		return 0;
+	}
+	len = MIN(r->srclen, r->soft_limit[0]) - r->off;
+
+	i = 0;
+	if (r->type == HERODOTUS_TYPE_CODEPOINT) {
+		cp = (const uint_least32_t *)(r->src) + r->off;
+
+		for (; i < len && cp[i] < 0x80; i++) {
+			if (cp[i] == 0 && r->srclen == SIZE_MAX) {
+				/* leave the terminating NUL to the reader */
+				break;
+			}
+		}
+	} else { /* r->type == HERODOTUS_TYPE_UTF8 */
+		src = (const unsigned char *)(r->src) + r->off;
+
+		if (r->srclen != SIZE_MAX) {
+			for (; len - i >= 8 &&
+			       !(ascii_word_load(src + i) & ASCII_WORD(0x80));
+			     i += 8) {
+				;
+			}
+		}
+		for (; i < len && src[i] < 0x80; i++) {
+			if (src[i] == '\0' && r->srclen == SIZE_MAX) {
+				/* leave the NUL-byte to the reader */
+				break;
+			}
+		}
+	}
+	r->off += i;
+
+	return i;
+}
+
 enum herodotus_status
 herodotus_read_codepoint(HERODOTUS_READER *r, bool advance, uint_least32_t *cp)
 {
@@ -247,6 +347,54 @@ herodotus_writer_number_written(const HERODOTUS_WRITER *w)
 	return w->off;
 }
 
+size_t
+herodotus_writer_window(const HERODOTUS_WRITER *w, void **dest)
+{
+	size_t room;
+
+	/*
+	 * The window holds the units that can be written at the writer
+	 * position, which, like herodotus_write_codepoint(), leaves
+	 * room for the terminating NUL-byte in UTF-8-buffers.
+	 */
+	if (w->dest == NULL || w->off >= w->destlen) {
+		room = 0;
+	} else if (w->type == HERODOTUS_TYPE_CODEPOINT) {
+		room = w->destlen - w->off;
+	} else { /* w->type == HERODOTUS_TYPE_UTF8 */
+		room = w->destlen - w->off - 1;
+	}
+
+	if (dest != NULL) {
+		if (room == 0) {
+			*dest = NULL;
+		} else if (w->type == HERODOTUS_TYPE_CODEPOINT) {
+			*dest = (uint_least32_t *)(w->dest) + w->off;
+		} else { /* w->type == HERODOTUS_TYPE_UTF8 */
+			*dest = (char *)(w->dest) + w->off;
+		}
+	}
+
+	return room;
+}
+
+void
+herodotus_writer_advance(HERODOTUS_WRITER *w, size_t count)
+{
+	size_t room;
+
+	/*
+	 * The caller has written the units of single-unit codepoints
+	 * into the window, but we account for all of them like
+	 * herodotus_write_codepoint() would have done.
+	 */
+	room = herodotus_writer_window(w, NULL);
+	if (count > room && w->first_unwritable_offset == SIZE_MAX) {
+		w->first_unwritable_offset = w->off + room;
+	}
+	w->off += count;
+}
+
 void
 herodotus_write_codepoint(HERODOTUS_WRITER *w, uint_least32_t cp)
 {
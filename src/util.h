@@ -31,6 +31,19 @@
 #define unlikely(expr) (expr)
 #endif
 
+/* broadcast a byte to all bytes of a 64-bit word */
+#define ASCII_WORD(c) (UINT64_C(0x0101010101010101) * (c))
+
+static inline uint_least64_t
+ascii_word_load(const unsigned char *s)
+{
+	/* compilers turn this into a single (unaligned) load */
+	return (uint_least64_t)s[0] | (uint_least64_t)s[1] << 8 |
+	       (uint_least64_t)s[2] << 16 | (uint_least64_t)s[3] << 24 |
+	       (uint_least64_t)s[4] << 32 | (uint_least64_t)s[5] << 40 |
+	       (uint_least64_t)s[6] << 48 | (uint_least64_t)s[7] << 56;
+}
+
 /*
  * Herodotus, the ancient greek historian and geographer,
  * was criticized for including legends and other fantastic
@@ -93,12 +106,39 @@ struct proper {
 	void (*skip_shift_callback)(uint_least8_t, void *);
 };
 
+struct word_break_state {
+	bool ri_even;
+};
+
+/*
+ * The word break iterator determines the consecutive words of a
+ * text in one pass. It must not be moved after initialization, as
+ * the proper points to the state.
+ */
+struct word_break_iterator {
+	struct proper p;
+	struct word_break_state state;
+};
+
+/*
+ * the break properties of all segmentations, looked up as
+ * segment_data[segment_minor[segment_major[cp >> 8] + (cp & 0xff)]]
+ */
+extern const struct segment_properties segment_data[];
+extern const uint_least16_t segment_major[];
+extern const uint_least8_t segment_minor[];
+
 void herodotus_reader_init(HERODOTUS_READER *, enum herodotus_type,
                            const void *, size_t);
 void herodotus_reader_copy(const HERODOTUS_READER *, HERODOTUS_READER *);
 void herodotus_reader_push_advance_limit(HERODOTUS_READER *, size_t);
 void herodotus_reader_pop_limit(HERODOTUS_READER *);
 size_t herodotus_reader_number_read(const HERODOTUS_READER *);
+size_t herodotus_reader_window(const HERODOTUS_READER *, enum herodotus_type,
+                               const void **, bool *);
+void herodotus_reader_advance(HERODOTUS_READER *, size_t);
+void herodotus_reader_seek(HERODOTUS_READER *, size_t);
+size_t herodotus_reader_skip_ascii(HERODOTUS_READER *);
 size_t herodotus_reader_next_word_break(const HERODOTUS_READER *);
 size_t herodotus_reader_next_codepoint_break(const HERODOTUS_READER *);
 enum herodotus_status herodotus_read_codepoint(HERODOTUS_READER *, bool,
@@ -108,6 +148,8 @@ void herodotus_writer_init(HERODOTUS_WRITER *, enum herodotus_type, void *,
                            size_t);
 void herodotus_writer_nul_terminate(HERODOTUS_WRITER *);
 size_t herodotus_writer_number_written(const HERODOTUS_WRITER *);
+size_t herodotus_writer_window(const HERODOTUS_WRITER *, void **);
+void herodotus_writer_advance(HERODOTUS_WRITER *, size_t);
 void herodotus_write_codepoint(HERODOTUS_WRITER *, uint_least32_t);
 
 void proper_init(const HERODOTUS_READER *, void *, uint_least8_t,
@@ -117,4 +159,10 @@ void proper_init(const HERODOTUS_READER *, void *, uint_least8_t,
                  struct proper *);
 int proper_advance(struct proper *);
 
+void word_break_iterator_init(struct word_break_iterator *,
+                              const HERODOTUS_READER *);
+size_t word_break_iterator_next(struct word_break_iterator *);
+
+size_t wrap_line(HERODOTUS_READER *, size_t, size_t *);
+
 #endif /* UTIL_H */
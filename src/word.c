@@ -6,17 +6,14 @@
 #include "../grapheme.h"
 #include "util.h"
 
-struct word_break_state {
-	bool ri_even;
-};
-
 static inline uint_least8_t
 get_word_break_prop(uint_least32_t cp)
 {
 	if (likely(cp <= UINT32_C(0x10FFFF))) {
 		return (uint_least8_t)
-			word_break_minor[word_break_major[cp >> 8] +
-		                         (cp & 0xff)];
+			segment_data[segment_minor[segment_major[cp >> 8] +
+		                                   (cp & 0xff)]]
+				.word_break;
 	} else {
 		return WORD_BREAK_PROP_OTHER;
 	}
@@ -56,208 +53,243 @@ word_skip_shift_callback(uint_least8_t prop, void *s)
 	}
 }
 
-static size_t
-next_word_break(HERODOTUS_READER *r)
+static void
+advance_to_word_break(struct proper *p, struct word_break_state *state)
 {
-	struct proper p;
-	struct word_break_state state = { .ri_even = true };
-
 	/*
 	 * Apply word breaking algorithm (UAX #29), see
 	 * https://unicode.org/reports/tr29/#Word_Boundary_Rules
 	 */
-	proper_init(r, &state, NUM_WORD_BREAK_PROPS, get_word_break_prop,
-	            is_skippable_word_prop, word_skip_shift_callback, &p);
-
-	while (!proper_advance(&p)) {
+	while (!proper_advance(p)) {
 		/* WB3 */
-		if (p.raw.prev_prop[0] == WORD_BREAK_PROP_CR &&
-		    p.raw.next_prop[0] == WORD_BREAK_PROP_LF) {
+		if (p->raw.prev_prop[0] == WORD_BREAK_PROP_CR &&
+		    p->raw.next_prop[0] == WORD_BREAK_PROP_LF) {
 			continue;
 		}
 
 		/* WB3a */
-		if (p.raw.prev_prop[0] == WORD_BREAK_PROP_NEWLINE ||
-		    p.raw.prev_prop[0] == WORD_BREAK_PROP_CR ||
-		    p.raw.prev_prop[0] == WORD_BREAK_PROP_LF) {
+		if (p->raw.prev_prop[0] == WORD_BREAK_PROP_NEWLINE ||
+		    p->raw.prev_prop[0] == WORD_BREAK_PROP_CR ||
+		    p->raw.prev_prop[0] == WORD_BREAK_PROP_LF) {
 			break;
 		}
 
 		/* WB3b */
-		if (p.raw.next_prop[0] == WORD_BREAK_PROP_NEWLINE ||
-		    p.raw.next_prop[0] == WORD_BREAK_PROP_CR ||
-		    p.raw.next_prop[0] == WORD_BREAK_PROP_LF) {
+		if (p->raw.next_prop[0] == WORD_BREAK_PROP_NEWLINE ||
+		    p->raw.next_prop[0] == WORD_BREAK_PROP_CR ||
+		    p->raw.next_prop[0] == WORD_BREAK_PROP_LF) {
 			break;
 		}
 
 		/* WB3c */
-		if (p.raw.prev_prop[0] == WORD_BREAK_PROP_ZWJ &&
-		    (p.raw.next_prop[0] ==
+		if (p->raw.prev_prop[0] == WORD_BREAK_PROP_ZWJ &&
+		    (p->raw.next_prop[0] ==
 		             WORD_BREAK_PROP_EXTENDED_PICTOGRAPHIC ||
-		     p.raw.next_prop[0] ==
+		     p->raw.next_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT)) {
 			continue;
 		}
 
 		/* WB3d */
-		if (p.raw.prev_prop[0] == WORD_BREAK_PROP_WSEGSPACE &&
-		    p.raw.next_prop[0] == WORD_BREAK_PROP_WSEGSPACE) {
+		if (p->raw.prev_prop[0] == WORD_BREAK_PROP_WSEGSPACE &&
+		    p->raw.next_prop[0] == WORD_BREAK_PROP_WSEGSPACE) {
 			continue;
 		}
 
 		/* WB4 */
-		if (p.raw.next_prop[0] == WORD_BREAK_PROP_EXTEND ||
-		    p.raw.next_prop[0] == WORD_BREAK_PROP_FORMAT ||
-		    p.raw.next_prop[0] == WORD_BREAK_PROP_ZWJ) {
+		if (p->raw.next_prop[0] == WORD_BREAK_PROP_EXTEND ||
+		    p->raw.next_prop[0] == WORD_BREAK_PROP_FORMAT ||
+		    p->raw.next_prop[0] == WORD_BREAK_PROP_ZWJ) {
 			continue;
 		}
 
 		/* WB5 */
-		if ((p.skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.prev_prop[0] ==
+		if ((p->skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.prev_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
-		    (p.skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.next_prop[0] ==
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
+		    (p->skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.next_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER)) {
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER)) {
 			continue;
 		}
 
 		/* WB6 */
-		if ((p.skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.prev_prop[0] ==
+		if ((p->skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.prev_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
-		    (p.skip.next_prop[0] == WORD_BREAK_PROP_MIDLETTER ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
-		    (p.skip.next_prop[1] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.next_prop[1] ==
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
+		    (p->skip.next_prop[0] == WORD_BREAK_PROP_MIDLETTER ||
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
+		    (p->skip.next_prop[1] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.next_prop[1] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.next_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER)) {
+		     p->skip.next_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER)) {
 			continue;
 		}
 
 		/* WB7 */
-		if ((p.skip.prev_prop[0] == WORD_BREAK_PROP_MIDLETTER ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
-		    (p.skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.next_prop[0] ==
+		if ((p->skip.prev_prop[0] == WORD_BREAK_PROP_MIDLETTER ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
+		    (p->skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.next_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
-		    (p.skip.prev_prop[1] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.prev_prop[1] ==
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
+		    (p->skip.prev_prop[1] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.prev_prop[1] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.prev_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER)) {
+		     p->skip.prev_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER)) {
 			continue;
 		}
 
 		/* WB7a */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) {
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) {
 			continue;
 		}
 
 		/* WB7b */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_DOUBLE_QUOTE &&
-		    p.skip.next_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER) {
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_DOUBLE_QUOTE &&
+		    p->skip.next_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER) {
 			continue;
 		}
 
 		/* WB7c */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_DOUBLE_QUOTE &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER &&
-		    p.skip.prev_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER) {
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_DOUBLE_QUOTE &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER &&
+		    p->skip.prev_prop[1] == WORD_BREAK_PROP_HEBREW_LETTER) {
 			continue;
 		}
 
 		/* WB8 */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC) {
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC) {
 			continue;
 		}
 
 		/* WB9 */
-		if ((p.skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.prev_prop[0] ==
+		if ((p->skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.prev_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC) {
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER) &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC) {
 			continue;
 		}
 
 		/* WB10 */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC &&
-		    (p.skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.next_prop[0] ==
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC &&
+		    (p->skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.next_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER)) {
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER)) {
 			continue;
 		}
 
 		/* WB11 */
-		if ((p.skip.prev_prop[0] == WORD_BREAK_PROP_MIDNUM ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC &&
-		    p.skip.prev_prop[1] == WORD_BREAK_PROP_NUMERIC) {
+		if ((p->skip.prev_prop[0] == WORD_BREAK_PROP_MIDNUM ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC &&
+		    p->skip.prev_prop[1] == WORD_BREAK_PROP_NUMERIC) {
 			continue;
 		}
 
 		/* WB12 */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC &&
-		    (p.skip.next_prop[0] == WORD_BREAK_PROP_MIDNUM ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
-		    p.skip.next_prop[1] == WORD_BREAK_PROP_NUMERIC) {
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC &&
+		    (p->skip.next_prop[0] == WORD_BREAK_PROP_MIDNUM ||
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_MIDNUMLET ||
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_SINGLE_QUOTE) &&
+		    p->skip.next_prop[1] == WORD_BREAK_PROP_NUMERIC) {
 			continue;
 		}
 
 		/* WB13 */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_KATAKANA &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_KATAKANA) {
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_KATAKANA &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_KATAKANA) {
 			continue;
 		}
 
 		/* WB13a */
-		if ((p.skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.prev_prop[0] ==
+		if ((p->skip.prev_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.prev_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_KATAKANA ||
-		     p.skip.prev_prop[0] == WORD_BREAK_PROP_EXTENDNUMLET) &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_EXTENDNUMLET) {
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_NUMERIC ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_KATAKANA ||
+		     p->skip.prev_prop[0] == WORD_BREAK_PROP_EXTENDNUMLET) &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_EXTENDNUMLET) {
 			continue;
 		}
 
 		/* WB13b */
-		if (p.skip.prev_prop[0] == WORD_BREAK_PROP_EXTENDNUMLET &&
-		    (p.skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
-		     p.skip.next_prop[0] ==
+		if (p->skip.prev_prop[0] == WORD_BREAK_PROP_EXTENDNUMLET &&
+		    (p->skip.next_prop[0] == WORD_BREAK_PROP_ALETTER ||
+		     p->skip.next_prop[0] ==
 		             WORD_BREAK_PROP_BOTH_ALETTER_EXTPICT ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC ||
-		     p.skip.next_prop[0] == WORD_BREAK_PROP_KATAKANA)) {
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_HEBREW_LETTER ||
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_NUMERIC ||
+		     p->skip.next_prop[0] == WORD_BREAK_PROP_KATAKANA)) {
 			continue;
 		}
 
 		/* WB15 and WB16 */
-		if (!state.ri_even &&
-		    p.skip.next_prop[0] == WORD_BREAK_PROP_REGIONAL_INDICATOR) {
+		if (!state->ri_even &&
+		    p->skip.next_prop[0] == WORD_BREAK_PROP_REGIONAL_INDICATOR) {
 			continue;
 		}
 
 		/* WB999 */
 		break;
 	}
+}
+
+static size_t
+next_word_break(HERODOTUS_READER *r)
+{
+	struct proper p;
+	struct word_break_state state = { .ri_even = true };
+
+	proper_init(r, &state, NUM_WORD_BREAK_PROPS, get_word_break_prop,
+	            is_skippable_word_prop, word_skip_shift_callback, &p);
+	advance_to_word_break(&p, &state);
 
 	return herodotus_reader_number_read(&(p.mid_reader));
 }
 
+void
+word_break_iterator_init(struct word_break_iterator *it,
+                         const HERODOTUS_READER *r)
+{
+	proper_init(r, &(it->state), NUM_WORD_BREAK_PROPS,
+	            get_word_break_prop, is_skippable_word_prop,
+	            word_skip_shift_callback, &(it->p));
+}
+
+size_t
+word_break_iterator_next(struct word_break_iterator *it)
+{
+	size_t off = herodotus_reader_number_read(&(it->p.mid_reader));
+
+	/*
+	 * The word breaking algorithm starting at a break only differs
+	 * from one that has been running up to it by the properties
+	 * behind the viewing line and the regional indicator parity,
+	 * which we reset. The properties ahead of it stay valid, which
+	 * saves us from reading them again.
+	 */
+	it->p.raw.prev_prop[1] = it->p.raw.prev_prop[0] = it->p.no_prop;
+	it->p.skip.prev_prop[1] = it->p.skip.prev_prop[0] = it->p.no_prop;
+	it->state.ri_even = true;
+
+	advance_to_word_break(&(it->p), &(it->state));
+
+	return herodotus_reader_number_read(&(it->p.mid_reader)) - off;
+}
+
 size_t
 grapheme_next_word_break(const uint_least32_t *str, size_t len)
 {
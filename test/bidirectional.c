@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "../gen/bidirectional-test.h"
 #include "../gen/bidirectional.h"
@@ -10,6 +11,1229 @@
 #include "../grapheme.h"
 #include "util.h"
 
+struct unit_test_reorder_line {
+	const char *description;
+
+	struct {
+		const uint_least32_t *src;
+		size_t srclen;
+		size_t destlen;
+	} input;
+
+	struct {
+		const uint_least32_t *dest;
+		size_t ret;
+	} output;
+};
+
+struct unit_test_reorder_line_utf8 {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t destlen;
+	} input;
+
+	struct {
+		const char *dest;
+		size_t ret;
+	} output;
+};
+
+struct unit_test_preprocess_document {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t parlen;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t parcount;
+		struct grapheme_bidirectional_paragraph par[3];
+	} output;
+};
+
+struct unit_test_preprocess_document_compact {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t buflen;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t maxparlen;
+		size_t written;
+	} output;
+};
+
+struct unit_test_reorder_line_map {
+	const char *description;
+
+	struct {
+		const uint_least32_t *src;
+		size_t srclen;
+		size_t visuallen;
+	} input;
+
+	struct {
+		const size_t *visual;
+		size_t ret;
+		const struct grapheme_bidirectional_run *run;
+		size_t runcount;
+	} output;
+};
+
+struct unit_test_layout_paragraph {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t columns;
+		size_t datalen;
+		size_t linelen;
+		size_t runlen;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t linecount;
+		size_t runcount;
+		struct grapheme_bidirectional_line line[3];
+		struct grapheme_bidirectional_run run[6];
+	} output;
+};
+
+struct unit_test_is_trivial_utf8 {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+	} input;
+
+	struct {
+		bool ret;
+	} output;
+};
+
+struct unit_test_get_offset_utf8 {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t off;
+	} input;
+
+	struct {
+		size_t ret;
+	} output;
+};
+
+struct unit_test_ascii_states {
+	const char *description;
+
+	struct {
+		uint_least32_t first, last;
+	} input;
+};
+
+struct unit_test_nested_isolates {
+	const char *description;
+
+	struct {
+		size_t depth;
+		const uint_least32_t *src;
+		size_t srclen;
+	} input;
+
+	struct {
+		const int_least8_t *level;
+	} output;
+};
+
+static const struct unit_test_reorder_line reorder_line_clusters[] = {
+	{
+		.description = "empty input",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x0 },
+			.srclen  = 0,
+			.destlen = 10,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ 0x0 },
+			.ret  = 0,
+		},
+	},
+	{
+		.description = "left-to-right cluster",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x61, 0x301, 0x62 },
+			.srclen  = 3,
+			.destlen = 10,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ 0x61, 0x301, 0x62 },
+			.ret  = 3,
+		},
+	},
+	{
+		.description = "right-to-left cluster",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x5D0, 0x5B0, 0x5D1 },
+			.srclen  = 3,
+			.destlen = 10,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ 0x5D1, 0x5D0, 0x5B0 },
+			.ret  = 3,
+		},
+	},
+	{
+		.description = "right-to-left cluster with removed character",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x5D0, 0x1F469, 0x200D, 0x1F4BB, 0x5D1 },
+			.srclen  = 5,
+			.destlen = 10,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ 0x5D1, 0x1F469, 0x1F4BB, 0x5D0 },
+			.ret  = 4,
+		},
+	},
+	{
+		.description = "right-to-left cluster with mirrored character",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x5D0, 0x28, 0x5D1, 0x29, 0x331 },
+			.srclen  = 5,
+			.destlen = 10,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ 0x28, 0x331, 0x5D1, 0x29, 0x5D0 },
+			.ret  = 5,
+		},
+	},
+	{
+		.description = "left-to-right cluster in right-to-left text",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x5D0, 0x20, 0x61, 0x301, 0x20, 0x62, 0x5D1 },
+			.srclen  = 7,
+			.destlen = 10,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ 0x5D1, 0x61, 0x301, 0x20, 0x62, 0x20, 0x5D0 },
+			.ret  = 7,
+		},
+	},
+	{
+		.description = "right-to-left cluster, output too small",
+		.input = {
+			.src     = (uint_least32_t *)(uint_least32_t[]){ 0x5D0, 0x5B0, 0x5D1 },
+			.srclen  = 3,
+			.destlen = 3,
+		},
+		.output = {
+			.dest = (uint_least32_t *)(uint_least32_t[]){ GRAPHEME_INVALID_CODEPOINT, GRAPHEME_INVALID_CODEPOINT, GRAPHEME_INVALID_CODEPOINT },
+			.ret  = 3,
+		},
+	},
+};
+
+static const struct unit_test_reorder_line_utf8 reorder_line_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 10 },
+		.output = { "", 0 },
+	},
+	{
+		.description = "left-to-right text",
+		.input = { "abc def", 7, 10 },
+		.output = { "abc def", 7 },
+	},
+	{
+		.description = "right-to-left text with mirrored characters",
+		.input = { "\xD7\x90\xD7\x91 (\xD7\x92)", 9, 10 },
+		.output = { "(\xD7\x92) \xD7\x91\xD7\x90", 9 },
+	},
+	{
+		.description = "mixed text with number",
+		.input = { "a \xD7\x90\xD7\x91 12", 9, 10 },
+		.output = { "a 12 \xD7\x91\xD7\x90", 9 },
+	},
+	{
+		.description = "right-to-left text with removed character",
+		.input = { "\xD7\x90\xE2\x80\x8D\xD7\x91", 7, 10 },
+		.output = { "\xD7\x91\xD7\x90", 4 },
+	},
+	{
+		.description = "right-to-left text, null-terminated",
+		.input = { "\xD7\x90\xD7\x91", SIZE_MAX, 10 },
+		.output = { "\xD7\x91\xD7\x90", 4 },
+	},
+	{
+		.description = "right-to-left text, output too small",
+		.input = { "\xD7\x90\xD7\x91", 4, 4 },
+		.output = { "", 4 },
+	},
+};
+
+static const struct unit_test_preprocess_document preprocess_document[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 3 },
+		.output = { 0, 0, { { 0 } } },
+	},
+	{
+		.description = "single paragraph",
+		.input = { "ab \xD7\x90", 5, 3 },
+		.output = {
+			4, 1,
+			{ { 0, 4, GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR } },
+		},
+	},
+	{
+		.description = "paragraphs of different direction",
+		.input = { "a\n\xD7\x90\n1", 6, 3 },
+		.output = {
+			5, 3,
+			{
+				{ 0, 2, GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR },
+				{ 2, 2, GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL },
+				{ 4, 1, GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR },
+			},
+		},
+	},
+	{
+		.description = "paragraph without strong character",
+		.input = { "1\n\xD7\x90", 4, 3 },
+		.output = {
+			3, 2,
+			{
+				{ 0, 2, GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR },
+				{ 2, 1, GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL },
+			},
+		},
+	},
+	{
+		.description = "strong character in isolate",
+		.input = { "\xE2\x81\xA6" "a\xE2\x81\xA9\xD7\x90", 9, 3 },
+		.output = {
+			4, 1,
+			{ { 0, 4, GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL } },
+		},
+	},
+	{
+		.description = "paragraph array too small",
+		.input = { "\xD7\x90\na\n\xD7\x90", 7, 1 },
+		.output = {
+			5, 3,
+			{ { 0, 2, GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL } },
+		},
+	},
+	{
+		.description = "null-terminated input",
+		.input = { "a\n\xD7\x90", SIZE_MAX, 3 },
+		.output = {
+			3, 2,
+			{
+				{ 0, 2, GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR },
+				{ 2, 1, GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL },
+			},
+		},
+	},
+};
+
+static const struct unit_test_preprocess_document_compact
+	preprocess_document_compact[] = {
+		{
+			.description = "empty input",
+			.input = { "", 0, 4 },
+			.output = { 0, 0, 0 },
+		},
+		{
+			.description = "single paragraph",
+			.input = { "ab \xD7\x90", 5, 4 },
+			.output = { 4, 4, 4 },
+		},
+		{
+			.description = "paragraphs of different direction",
+			.input = { "a\n\xD7\x90\n1", 6, 2 },
+			.output = { 5, 2, 5 },
+		},
+		{
+			.description = "buffer too small",
+			.input = { "ab\n\xD7\x90\xD7\x91\xD7\x92\xD7\x93"
+			           "\nc",
+			           13, 3 },
+			.output = { 9, 5, 3 },
+		},
+		{
+			.description = "null-terminated input",
+			.input = { "a\n\xD7\x90", SIZE_MAX, 4 },
+			.output = { 3, 2, 3 },
+		},
+};
+
+static const struct unit_test_reorder_line_map reorder_line_map[] = {
+	{
+		.description = "empty input",
+		.input = { NULL, 0, 10 },
+		.output = { NULL, 0, NULL, 0 },
+	},
+	{
+		.description = "left-to-right text",
+		.input = { (uint_least32_t[]){ 0x0061, 0x0062 }, 2, 10 },
+		.output = {
+			(size_t[]){ 0, 1 }, 2,
+			(struct grapheme_bidirectional_run[]){ { 0, 2, 0 } }, 1,
+		},
+	},
+	{
+		.description = "right-to-left text",
+		.input = { (uint_least32_t[]){ 0x05D0, 0x05D1 }, 2, 10 },
+		.output = {
+			(size_t[]){ 1, 0 }, 2,
+			(struct grapheme_bidirectional_run[]){ { 0, 2, 1 } }, 1,
+		},
+	},
+	{
+		.description = "mixed text with number",
+		.input = { (uint_least32_t[]){ 0x0061, 0x0020, 0x05D0, 0x05D1, 0x0020, 0x0031 }, 6, 10 },
+		.output = {
+			(size_t[]){ 0, 1, 5, 4, 3, 2 }, 6,
+			(struct grapheme_bidirectional_run[]){ { 0, 2, 0 }, { 5, 1, 2 }, { 2, 3, 1 } }, 3,
+		},
+	},
+	{
+		.description = "right-to-left text with removed character",
+		.input = { (uint_least32_t[]){ 0x05D0, 0x200D, 0x05D1 }, 3, 10 },
+		.output = {
+			(size_t[]){ 2, 0 }, 2,
+			(struct grapheme_bidirectional_run[]){ { 0, 3, 1 } }, 1,
+		},
+	},
+	{
+		.description = "right-to-left text with trailing whitespace",
+		.input = { (uint_least32_t[]){ 0x0061, 0x05D0, 0x0020 }, 3, 10 },
+		.output = {
+			(size_t[]){ 0, 1, 2 }, 3,
+			(struct grapheme_bidirectional_run[]){ { 0, 1, 0 }, { 1, 1, 1 }, { 2, 1, 0 } }, 3,
+		},
+	},
+	{
+		.description = "right-to-left text, visual map too small",
+		.input = { (uint_least32_t[]){ 0x05D0, 0x05D1 }, 2, 1 },
+		.output = {
+			(size_t[]){ SIZE_MAX }, 2,
+			(struct grapheme_bidirectional_run[]){ { 0, 2, 1 } }, 1,
+		},
+	},
+};
+
+static const struct unit_test_layout_paragraph layout_paragraph[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 10, 10, 3, 6 },
+		.output = { 0, 0, 0, { { 0 } }, { { 0 } } },
+	},
+	{
+		.description = "left-to-right text",
+		.input = { "ab cd ef", 8, 5, 10, 3, 6 },
+		.output = {
+			8,
+			2,
+			2,
+			{ { 0, 6, 0, 1 }, { 6, 2, 1, 1 } },
+			{ { 0, 6, 0 }, { 6, 2, 0 } },
+		},
+	},
+	{
+		.description = "mixed text",
+		.input = { "a \xD7\x90\xD7\x91 c", 8, 4, 10, 3, 6 },
+		.output = {
+			6,
+			2,
+			4,
+			{ { 0, 7, 0, 3 }, { 7, 1, 3, 1 } },
+			{ { 0, 2, 0 }, { 2, 4, 1 }, { 6, 1, 0 }, { 7, 1, 0 } },
+		},
+	},
+	{
+		.description = "right-to-left paragraph with number",
+		.input = { "\xD7\x90 1 b\nc", 8, 10, 10, 3, 6 },
+		.output = {
+			6,
+			1,
+			5,
+			{ { 0, 7, 0, 5 } },
+			{
+				{ 6, 1, 1 },
+				{ 5, 1, 2 },
+				{ 4, 1, 1 },
+				{ 3, 1, 2 },
+				{ 0, 3, 1 },
+			},
+		},
+	},
+	{
+		.description = "line array too small",
+		.input = { "ab cd ef", 8, 3, 10, 2, 6 },
+		.output = {
+			8,
+			3,
+			3,
+			{ { 0, 3, 0, 1 }, { 3, 3, 1, 1 } },
+			{ { 0, 3, 0 }, { 3, 3, 0 }, { 6, 2, 0 } },
+		},
+	},
+	{
+		.description = "run array too small",
+		.input = { "\xD7\x90 b \xD7\x91 c", 9, 4, 10, 3, 2 },
+		.output = {
+			7,
+			2,
+			5,
+			{ { 0, 5, 0, 3 }, { 5, 4, 3, 2 } },
+			{ { 0 } },
+		},
+	},
+	{
+		.description = "state array too small",
+		.input = { "ab cd", 5, 3, 2, 3, 6 },
+		.output = {
+			5,
+			2,
+			0,
+			{ { 0, 3, 0, 0 }, { 3, 2, 0, 0 } },
+			{ { 0 } },
+		},
+	},
+	{
+		.description = "null-terminated input",
+		.input = { "ab cd", SIZE_MAX, 3, 10, 3, 6 },
+		.output = {
+			5,
+			2,
+			2,
+			{ { 0, 3, 0, 1 }, { 3, 2, 1, 1 } },
+			{ { 0, 3, 0 }, { 3, 2, 0 } },
+		},
+	},
+};
+
+static const struct unit_test_get_offset_utf8 get_byte_offset_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 0 },
+		.output = { 0 },
+	},
+	{
+		.description = "ASCII",
+		.input = { "abc", 3, 2 },
+		.output = { 2 },
+	},
+	{
+		.description = "multibyte sequences",
+		.input = { "a\xD7\x90\xE4\xB8\x96\xF0\x9F\x98\x80"
+		           "b",
+		           11, 3 },
+		.output = { 6 },
+	},
+	{
+		.description = "multibyte sequences, end",
+		.input = { "a\xD7\x90\xE4\xB8\x96\xF0\x9F\x98\x80"
+		           "b",
+		           11, 5 },
+		.output = { 11 },
+	},
+	{
+		.description = "offset beyond the end",
+		.input = { "a\xD7\x90", 3, 10 },
+		.output = { 3 },
+	},
+	{
+		.description = "invalid UTF-8",
+		.input = { "a\xFF\xE4\xB8"
+		           "b\x80",
+		           6, 3 },
+		.output = { 4 },
+	},
+	{
+		.description = "invalid UTF-8, end",
+		.input = { "a\xFF\xE4\xB8"
+		           "b\x80",
+		           6, 5 },
+		.output = { 6 },
+	},
+	{
+		.description = "multibyte sequences, NUL-terminated",
+		.input = { "\xD7\x90\xE4\xB8\x96", SIZE_MAX, 2 },
+		.output = { 5 },
+	},
+};
+
+static const struct unit_test_get_offset_utf8 get_codepoint_offset_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 0 },
+		.output = { 0 },
+	},
+	{
+		.description = "ASCII",
+		.input = { "abc", 3, 2 },
+		.output = { 2 },
+	},
+	{
+		.description = "multibyte sequences",
+		.input = { "a\xD7\x90\xE4\xB8\x96\xF0\x9F\x98\x80"
+		           "b",
+		           11, 6 },
+		.output = { 3 },
+	},
+	{
+		.description = "multibyte sequences, within a sequence",
+		.input = { "a\xD7\x90\xE4\xB8\x96\xF0\x9F\x98\x80"
+		           "b",
+		           11, 8 },
+		.output = { 3 },
+	},
+	{
+		.description = "offset beyond the end",
+		.input = { "a\xD7\x90", 3, 10 },
+		.output = { 2 },
+	},
+	{
+		.description = "invalid UTF-8",
+		.input = { "a\xFF\xE4\xB8"
+		           "b\x80",
+		           6, 4 },
+		.output = { 3 },
+	},
+	{
+		.description = "invalid UTF-8, within a truncated sequence",
+		.input = { "a\xFF\xE4\xB8"
+		           "b\x80",
+		           6, 3 },
+		.output = { 2 },
+	},
+	{
+		.description = "multibyte sequences, NUL-terminated",
+		.input = { "\xD7\x90\xE4\xB8\x96", SIZE_MAX, 5 },
+		.output = { 2 },
+	},
+};
+
+static const struct unit_test_is_trivial_utf8 is_trivial_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0 },
+		.output = { true },
+	},
+	{
+		.description = "empty input, NUL-terminated",
+		.input = { "", SIZE_MAX },
+		.output = { true },
+	},
+	{
+		.description = "ASCII",
+		.input = { "Hello, world!", 13 },
+		.output = { true },
+	},
+	{
+		.description = "ASCII with brackets, numbers and line breaks",
+		.input = { "(abc) [123]\r\n{x-y}", 19 },
+		.output = { true },
+	},
+	{
+		.description = "left-to-right non-ASCII",
+		.input = { "\xC3\xA9\xE4\xB8\x96", 5 },
+		.output = { true },
+	},
+	{
+		.description = "Hebrew",
+		.input = { "a\xD7\x90", 3 },
+		.output = { false },
+	},
+	{
+		.description = "Hebrew after a long ASCII run",
+		.input = { "abcdefghijklmnop\xD7\x90", 18 },
+		.output = { false },
+	},
+	{
+		.description = "Hebrew beyond the end",
+		.input = { "abcdefghijklmnop\xD7\x90", 16 },
+		.output = { true },
+	},
+	{
+		.description = "explicit embedding",
+		.input = { "abc\xE2\x80\xAB", 6 },
+		.output = { false },
+	},
+	{
+		.description = "isolate initiator",
+		.input = { "\xE2\x81\xA6" "abc", 6 },
+		.output = { false },
+	},
+	{
+		.description = "ASCII, NUL-terminated",
+		.input = { "abcdefghijklmnop", SIZE_MAX },
+		.output = { true },
+	},
+	{
+		.description = "Hebrew, NUL-terminated",
+		.input = { "abcdefghijklmnop\xD7\x90", SIZE_MAX },
+		.output = { false },
+	},
+	{
+		.description = "Hebrew after the terminating NUL",
+		.input = { "abc\0\xD7\x90", SIZE_MAX },
+		.output = { true },
+	},
+	{
+		.description = "Hebrew after a NUL within the input",
+		.input = { "abc\0\xD7\x90", 6 },
+		.output = { false },
+	},
+	{
+		.description = "truncated sequence",
+		.input = { "ab\xD7", 3 },
+		.output = { true },
+	},
+	{
+		.description = "truncated Hebrew",
+		.input = { "ab\xD7\x90", 3 },
+		.output = { true },
+	},
+	{
+		.description = "truncated sequence before Hebrew",
+		.input = { "ab\xE4\xB8\xD7\x90", 6 },
+		.output = { false },
+	},
+};
+
+static const struct unit_test_ascii_states ascii_states[] = {
+	{
+		.description = "ASCII control characters",
+		.input = { 0x00, 0x1F },
+	},
+	{
+		.description = "printable ASCII characters and DEL",
+		.input = { 0x20, 0x7F },
+	},
+};
+
+static const struct unit_test_nested_isolates nested_isolates[] = {
+	{
+		.description = "numbers within valid isolates",
+		.input = { 125, (uint_least32_t[]){ 0x0024, 0x0031 }, 2 },
+		.output = { (int_least8_t[]){ 126, 126 } },
+	},
+	{
+		.description = "numbers within an overflow isolate",
+		.input = { 126, (uint_least32_t[]){ 0x0024, 0x0031 }, 2 },
+		.output = { (int_least8_t[]){ 126, 126 } },
+	},
+	{
+		.description = "numbers within 75 overflow isolates",
+		.input = { 200, (uint_least32_t[]){ 0x0024, 0x0031 }, 2 },
+		.output = { (int_least8_t[]){ 126, 126 } },
+	},
+	{
+		.description = "number within a nested overflow isolate",
+		.input = { 130, (uint_least32_t[]){ 0x0061, 0x2067, 0x0031, 0x2069, 0x05D0 }, 5 },
+		.output = { (int_least8_t[]){ 126, 126, 126, 125, 125 } },
+	},
+};
+
+static int
+unit_test_callback_ascii_states(const void *t, size_t off, const char *name,
+                                const char *argv0)
+{
+	const struct unit_test_ascii_states *test =
+		(const struct unit_test_ascii_states *)t + off;
+	uint_least32_t cp, src[2], data[2], data_utf8[2];
+	char src_utf8[2];
+	size_t len, ret;
+
+	/*
+	 * The first of two equal ASCII characters is read by the general
+	 * path, the second one is copied from the precomputed states
+	 * of the ASCII run. A trivial left-to-right paragraph is not
+	 * resolved any further, so both states are equal.
+	 */
+	for (cp = test->input.first; cp <= test->input.last; cp++) {
+		src[0] = src[1] = cp;
+		src_utf8[0] = src_utf8[1] = (char)cp;
+
+		if (t == ascii_states) {
+			len = grapheme_bidirectional_preprocess_paragraph(
+				src, LEN(src),
+				GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR, data,
+				LEN(data), NULL);
+			ret = grapheme_bidirectional_preprocess_paragraph_utf8(
+				src_utf8, LEN(src_utf8),
+				GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR, data_utf8,
+				LEN(data_utf8), NULL);
+		} else {
+			goto err;
+		}
+
+		/* check results */
+		if (len != ret ||
+		    memcmp(data, data_utf8, len * sizeof(*data))) {
+			goto err;
+		}
+		if (len == 1) {
+			/* paragraph separators end the paragraph */
+			continue;
+		}
+		if (len != LEN(data) || data[0] != data[1]) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr, "%s: %s: Failed unit test %zu \"%s\" at 0x%02X.\n",
+	        argv0, name, off, test->description, (unsigned int)cp);
+	return 1;
+}
+
+static int
+unit_test_callback_nested_isolates(const void *t, size_t off, const char *name,
+                                   const char *argv0)
+{
+	const struct unit_test_nested_isolates *test =
+		(const struct unit_test_nested_isolates *)t + off;
+	uint_least32_t src[512], data[512];
+	int_least8_t lev[512];
+	size_t srclen, i;
+
+	/*
+	 * nest the input in alternating right-to-left and left-to-right
+	 * isolates, followed by a left-to-right character that keeps
+	 * the closing PDIs from being trailing whitespace
+	 */
+	for (srclen = 0; srclen < test->input.depth; srclen++) {
+		src[srclen] = (srclen % 2 == 0) ? 0x2067 : 0x2066;
+	}
+	for (i = 0; i < test->input.srclen; i++) {
+		src[srclen++] = test->input.src[i];
+	}
+	for (i = 0; i < test->input.depth; i++) {
+		src[srclen++] = 0x2069;
+	}
+	src[srclen++] = 0x0061;
+
+	if (t == nested_isolates) {
+		(void)grapheme_bidirectional_get_line_embedding_levels(
+			data,
+			grapheme_bidirectional_preprocess_paragraph(
+				src, srclen,
+				GRAPHEME_BIDIRECTIONAL_DIRECTION_LTR, data,
+				LEN(data), NULL),
+			lev, LEN(lev));
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (memcmp(lev + test->input.depth, test->output.level,
+	           test->input.srclen * sizeof(*lev))) {
+		goto err;
+	}
+
+	return 0;
+err:
+	fprintf(stderr, "%s: %s: Failed unit test %zu \"%s\".\n", argv0, name,
+	        off, test->description);
+	return 1;
+}
+
+static int
+unit_test_callback_get_offset_utf8(const void *t, size_t off, const char *name,
+                                   const char *argv0)
+{
+	const struct unit_test_get_offset_utf8 *test =
+		(const struct unit_test_get_offset_utf8 *)t + off;
+	uint_least32_t data[16];
+	size_t ret = 0, len;
+
+	len = grapheme_bidirectional_preprocess_paragraph_utf8(
+		test->input.src, test->input.srclen,
+		GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, data, LEN(data),
+		NULL);
+	if (len > LEN(data)) {
+		goto err;
+	}
+
+	if (t == get_byte_offset_utf8) {
+		ret = grapheme_bidirectional_get_byte_offset(data, len,
+		                                             test->input.off);
+	} else if (t == get_codepoint_offset_utf8) {
+		ret = grapheme_bidirectional_get_codepoint_offset(
+			data, len, test->input.off);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret) {
+		goto err;
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_is_trivial_utf8(const void *t, size_t off, const char *name,
+                                   const char *argv0)
+{
+	const struct unit_test_is_trivial_utf8 *test =
+		(const struct unit_test_is_trivial_utf8 *)t + off;
+	bool ret;
+
+	ret = grapheme_bidirectional_is_trivial_utf8(test->input.src,
+	                                             test->input.srclen);
+
+	/* check results */
+	if (ret != test->output.ret) {
+		goto err;
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %d instead of %d).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_layout_paragraph(const void *t, size_t off,
+                                    const char *name, const char *argv0)
+{
+	const struct unit_test_layout_paragraph *test =
+		(const struct unit_test_layout_paragraph *)t + off;
+	struct grapheme_bidirectional_line line[3];
+	struct grapheme_bidirectional_run run[6];
+	uint_least32_t data[10];
+	size_t ret = 0, linecount, runcount, i;
+
+	if (t == layout_paragraph) {
+		ret = grapheme_bidirectional_layout_paragraph_utf8(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL,
+			test->input.columns, data,
+			MIN(test->input.datalen, LEN(data)), line,
+			MIN(test->input.linelen, LEN(line)), &linecount, run,
+			MIN(test->input.runlen, LEN(run)), &runcount);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret ||
+	    linecount != test->output.linecount ||
+	    runcount != test->output.runcount) {
+		goto err;
+	}
+	for (i = 0; i < MIN(linecount, test->input.linelen); i++) {
+		if (line[i].off != test->output.line[i].off ||
+		    line[i].len != test->output.line[i].len ||
+		    line[i].runoff != test->output.line[i].runoff ||
+		    line[i].runcount != test->output.line[i].runcount) {
+			goto err;
+		}
+	}
+	for (i = 0; runcount <= test->input.runlen && i < runcount; i++) {
+		if (run[i].off != test->output.run[i].off ||
+		    run[i].len != test->output.run[i].len ||
+		    run[i].level != test->output.run[i].level) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_reorder_line_map(const void *t, size_t off,
+                                    const char *name, const char *argv0)
+{
+	const struct unit_test_reorder_line_map *test =
+		(const struct unit_test_reorder_line_map *)t + off;
+	struct grapheme_bidirectional_run run[10];
+	uint_least32_t data[10];
+	size_t visual[10], logical[10], ret = 0, len, runcount, i;
+
+	if (t == reorder_line_map) {
+		len = grapheme_bidirectional_preprocess_paragraph(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, data,
+			LEN(data), NULL);
+		ret = grapheme_bidirectional_reorder_line_map(
+			data, len, visual, test->input.visuallen, logical,
+			LEN(logical));
+		runcount = grapheme_bidirectional_reorder_line_runs(
+			data, len, run, LEN(run));
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret ||
+	    memcmp(visual, test->output.visual,
+	           MIN(test->input.visuallen, ret) * sizeof(*visual)) ||
+	    runcount != test->output.runcount) {
+		goto err;
+	}
+	for (i = 0; ret <= test->input.visuallen && i < ret; i++) {
+		if (logical[visual[i]] != i) {
+			goto err;
+		}
+	}
+	for (i = 0; i < runcount; i++) {
+		if (run[i].off != test->output.run[i].off ||
+		    run[i].len != test->output.run[i].len ||
+		    run[i].level != test->output.run[i].level) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_preprocess_document_compact(const void *t, size_t off,
+                                               const char *name,
+                                               const char *argv0)
+{
+	const struct unit_test_preprocess_document_compact *test =
+		(const struct unit_test_preprocess_document_compact *)t + off;
+	struct grapheme_bidirectional_paragraph par[3];
+	uint_least32_t buf[10], data[10], expanded[10];
+	uint_least16_t compact[10];
+	int_least8_t lev[10], expanded_lev[10];
+	size_t ret = 0, maxparlen, parcount, i;
+
+	for (i = 0; i < LEN(compact); i++) {
+		compact[i] = 0xDEAD;
+	}
+
+	if (t == preprocess_document_compact) {
+		ret = grapheme_bidirectional_preprocess_document_compact_utf8(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, compact,
+			LEN(compact), buf, test->input.buflen, &maxparlen, par,
+			LEN(par), &parcount);
+		(void)grapheme_bidirectional_preprocess_document_utf8(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, data,
+			LEN(data), NULL, 0, NULL);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret || maxparlen != test->output.maxparlen) {
+		goto err;
+	}
+	for (i = test->output.written; i < LEN(compact); i++) {
+		if (compact[i] != 0xDEAD) {
+			/* the states of paragraphs that did not fit */
+			goto err;
+		}
+	}
+
+	/* the written states have the same line levels */
+	(void)grapheme_bidirectional_expand_states(
+		compact, test->output.written, expanded, LEN(expanded));
+	for (i = 0; i < MIN(parcount, LEN(par)); i++) {
+		if (par[i].off + par[i].len > test->output.written) {
+			break;
+		}
+		if (grapheme_bidirectional_get_line_embedding_levels(
+			    data + par[i].off, par[i].len, lev, LEN(lev)) !=
+		            grapheme_bidirectional_get_line_embedding_levels(
+				    expanded + par[i].off, par[i].len,
+				    expanded_lev, LEN(expanded_lev)) ||
+		    memcmp(lev, expanded_lev, par[i].len * sizeof(*lev))) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_preprocess_document(const void *t, size_t off,
+                                       const char *name, const char *argv0)
+{
+	const struct unit_test_preprocess_document *test =
+		(const struct unit_test_preprocess_document *)t + off;
+	struct grapheme_bidirectional_paragraph par[3];
+	uint_least32_t data[10];
+	size_t ret = 0, parcount, i;
+
+	if (t == preprocess_document) {
+		ret = grapheme_bidirectional_preprocess_document_utf8(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, data,
+			LEN(data), par, test->input.parlen, &parcount);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret || parcount != test->output.parcount) {
+		goto err;
+	}
+	for (i = 0; i < MIN(parcount, test->input.parlen); i++) {
+		if (par[i].off != test->output.par[i].off ||
+		    par[i].len != test->output.par[i].len ||
+		    par[i].direction != test->output.par[i].direction) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_reorder_line(const void *t, size_t off, const char *name,
+                                const char *argv0)
+{
+	const struct unit_test_reorder_line *test =
+		(const struct unit_test_reorder_line *)t + off;
+	uint_least32_t data[10], dest[10];
+	size_t ret = 0, i;
+
+	/* fill the output with canary values */
+	for (i = 0; i < LEN(dest); i++) {
+		dest[i] = UINT32_C(0x7F);
+	}
+
+	if (t == reorder_line_clusters) {
+		ret = grapheme_bidirectional_preprocess_paragraph(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, data,
+			LEN(data), NULL);
+		ret = grapheme_bidirectional_reorder_line_clusters(
+			test->input.src, data, ret, dest, test->input.destlen);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret ||
+	    memcmp(dest, test->output.dest,
+	           MIN(test->input.destlen, ret) * sizeof(*dest))) {
+		goto err;
+	}
+
+	/* check that none of the canary values have been overwritten */
+	for (i = test->input.destlen; i < LEN(dest); i++) {
+		if (dest[i] != UINT32_C(0x7F)) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_reorder_line_utf8(const void *t, size_t off,
+                                     const char *name, const char *argv0)
+{
+	const struct unit_test_reorder_line_utf8 *test =
+		(const struct unit_test_reorder_line_utf8 *)t + off;
+	uint_least32_t data[10];
+	size_t ret = 0, i;
+	char dest[10];
+
+	/* fill the output with canary values */
+	memset(dest, 0x7f, LEN(dest));
+
+	if (t == reorder_line_utf8) {
+		ret = grapheme_bidirectional_preprocess_paragraph_utf8(
+			test->input.src, test->input.srclen,
+			GRAPHEME_BIDIRECTIONAL_DIRECTION_NEUTRAL, data,
+			LEN(data), NULL);
+		ret = grapheme_bidirectional_reorder_line_utf8(
+			test->input.src, data, ret, dest, test->input.destlen);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret ||
+	    memcmp(dest, test->output.dest,
+	           MIN(test->input.destlen, strlen(test->output.dest) + 1))) {
+		goto err;
+	}
+
+	/* check that none of the canary values have been overwritten */
+	for (i = test->input.destlen; i < LEN(dest); i++) {
+		if (dest[i] != 0x7f) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
 static inline int_least16_t
 get_mirror_offset(uint_least32_t cp)
 {
@@ -24,9 +1248,10 @@ int
 main(int argc, char *argv[])
 {
 	enum grapheme_bidirectional_direction resolved;
-	uint_least32_t data[512], output[512],
-		target; /* TODO iterate and get max, allocate */
-	int_least8_t lev[512];
+	uint_least32_t data[512], links[512], output[512], expanded[512],
+		reordered[512], target; /* TODO iterate and get max, allocate */
+	uint_least16_t compact[512];
+	int_least8_t lev[512], compact_lev[512];
 	size_t i, num_tests, failed, datalen, levlen, outputlen, ret, j, m,
 		ret2;
 
@@ -42,11 +1267,11 @@ main(int argc, char *argv[])
 
 	for (i = 0, failed = 0; i < LEN(bidirectional_test); i++) {
 		for (m = 0; m < bidirectional_test[i].modelen; m++) {
-			ret = grapheme_bidirectional_preprocess_paragraph(
+			ret = grapheme_bidirectional_preprocess_paragraph_links(
 				bidirectional_test[i].cp,
 				bidirectional_test[i].cplen,
 				bidirectional_test[i].mode[m], data, datalen,
-				&resolved);
+				links, &resolved);
 			ret2 = 0;
 
 			if (ret != bidirectional_test[i].cplen ||
@@ -76,6 +1301,19 @@ main(int argc, char *argv[])
 				}
 			}
 
+			/* trivial paragraphs are entirely left-to-right */
+			if (bidirectional_test[i].mode[m] !=
+			            GRAPHEME_BIDIRECTIONAL_DIRECTION_RTL &&
+			    grapheme_bidirectional_is_trivial(
+				    bidirectional_test[i].cp,
+				    bidirectional_test[i].cplen)) {
+				for (j = 0; j < ret; j++) {
+					if (lev[j] > 0) {
+						goto err;
+					}
+				}
+			}
+
 			/* reordering */
 			ret2 = grapheme_bidirectional_reorder_line(
 				bidirectional_test[i].cp, data, ret, output,
@@ -97,6 +1335,30 @@ main(int argc, char *argv[])
 				}
 			}
 
+			/*
+			 * the compact states give the same results, where
+			 * we also check that the isolates are resolved
+			 * the same without the links
+			 */
+			if (grapheme_bidirectional_preprocess_document_compact(
+				    bidirectional_test[i].cp,
+				    bidirectional_test[i].cplen,
+				    bidirectional_test[i].mode[m], compact,
+				    LEN(compact), expanded, LEN(expanded), NULL,
+				    NULL, 0, NULL) != ret ||
+			    grapheme_bidirectional_expand_states(
+				    compact, ret, expanded, LEN(expanded)) !=
+			            ret ||
+			    grapheme_bidirectional_get_line_embedding_levels(
+				    expanded, ret, compact_lev, levlen) != ret ||
+			    memcmp(compact_lev, lev, ret * sizeof(*lev)) ||
+			    grapheme_bidirectional_reorder_line(
+				    bidirectional_test[i].cp, expanded, ret,
+				    reordered, outputlen) != ret2 ||
+			    memcmp(reordered, output, ret2 * sizeof(*output))) {
+				goto err;
+			}
+
 			continue;
 err:
 			fprintf(stderr,
@@ -138,5 +1400,51 @@ err:
 	printf("%s: %zu/%zu conformance tests passed.\n", argv[0],
 	       num_tests - failed, num_tests);
 
-	return 0;
+	return run_unit_tests(unit_test_callback_preprocess_document,
+	                      preprocess_document, LEN(preprocess_document),
+	                      "grapheme_bidirectional_preprocess_document_utf8",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_preprocess_document_compact,
+	                      preprocess_document_compact,
+	                      LEN(preprocess_document_compact),
+	                      "grapheme_bidirectional_preprocess_document_"
+	                      "compact_utf8",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_reorder_line,
+	                      reorder_line_clusters, LEN(reorder_line_clusters),
+	                      "grapheme_bidirectional_reorder_line_clusters",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_reorder_line_utf8,
+	                      reorder_line_utf8, LEN(reorder_line_utf8),
+	                      "grapheme_bidirectional_reorder_line_utf8",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_reorder_line_map,
+	                      reorder_line_map, LEN(reorder_line_map),
+	                      "grapheme_bidirectional_reorder_line_map",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_layout_paragraph,
+	                      layout_paragraph, LEN(layout_paragraph),
+	                      "grapheme_bidirectional_layout_paragraph_utf8",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_get_offset_utf8,
+	                      get_byte_offset_utf8, LEN(get_byte_offset_utf8),
+	                      "grapheme_bidirectional_get_byte_offset",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_get_offset_utf8,
+	                      get_codepoint_offset_utf8,
+	                      LEN(get_codepoint_offset_utf8),
+	                      "grapheme_bidirectional_get_codepoint_offset",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_is_trivial_utf8,
+	                      is_trivial_utf8, LEN(is_trivial_utf8),
+	                      "grapheme_bidirectional_is_trivial_utf8",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_ascii_states, ascii_states,
+	                      LEN(ascii_states),
+	                      "grapheme_bidirectional_preprocess_paragraph",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_nested_isolates,
+	                      nested_isolates, LEN(nested_isolates),
+	                      "grapheme_bidirectional_preprocess_paragraph",
+	                      argv[0]);
 }
@@ -36,6 +36,69 @@ struct unit_test_to_case_utf8 {
 	} output;
 };
 
+struct unit_test_to_case_inplace_utf8 {
+	const char *description;
+
+	struct {
+		const char *str;
+		size_t len;
+	} input;
+
+	struct {
+		const char *str;
+		size_t ret;
+	} output;
+};
+
+struct unit_test_to_case_batch_utf8 {
+	const char *description;
+
+	struct {
+		const char *src[3];
+		size_t srclen[3];
+		size_t count;
+		size_t destlen;
+	} input;
+
+	struct {
+		const char *dest;
+		size_t ret;
+		size_t ends[3];
+	} output;
+};
+
+struct unit_test_caseless_compare_utf8 {
+	const char *description;
+
+	struct {
+		const char *a;
+		size_t alen;
+		const char *b;
+		size_t blen;
+	} input;
+
+	struct {
+		int ret;
+	} output;
+};
+
+struct unit_test_caseless_hash_utf8 {
+	const char *description;
+
+	struct {
+		const char *a;
+		size_t alen;
+		uint_least64_t aseed;
+		const char *b;
+		size_t blen;
+		uint_least64_t bseed;
+	} input;
+
+	struct {
+		bool equal;
+	} output;
+};
+
 static const struct unit_test_is_case_utf8 is_lowercase_utf8[] = {
 	{
 		.description = "empty input",
@@ -104,6 +167,151 @@ static const struct unit_test_is_case_utf8 is_lowercase_utf8[] = {
 	                   SIZE_MAX },
 		.output = { true, 11 },
 	},
+	{
+		.description = "ASCII run, violation at byte 0 of word 1",
+		.input = { "Abcdefghijklmnopqrs", 19 },
+		.output = { false, 0 },
+	},
+	{
+		.description = "ASCII run, violation at byte 1 of word 1",
+		.input = { "aBcdefghijklmnopqrs", 19 },
+		.output = { false, 1 },
+	},
+	{
+		.description = "ASCII run, violation at byte 2 of word 1",
+		.input = { "abCdefghijklmnopqrs", 19 },
+		.output = { false, 2 },
+	},
+	{
+		.description = "ASCII run, violation at byte 3 of word 1",
+		.input = { "abcDefghijklmnopqrs", 19 },
+		.output = { false, 3 },
+	},
+	{
+		.description = "ASCII run, violation at byte 4 of word 1",
+		.input = { "abcdEfghijklmnopqrs", 19 },
+		.output = { false, 4 },
+	},
+	{
+		.description = "ASCII run, violation at byte 5 of word 1",
+		.input = { "abcdeFghijklmnopqrs", 19 },
+		.output = { false, 5 },
+	},
+	{
+		.description = "ASCII run, violation at byte 6 of word 1",
+		.input = { "abcdefGhijklmnopqrs", 19 },
+		.output = { false, 6 },
+	},
+	{
+		.description = "ASCII run, violation at byte 7 of word 1",
+		.input = { "abcdefgHijklmnopqrs", 19 },
+		.output = { false, 7 },
+	},
+	{
+		.description = "ASCII run, violation at byte 0 of word 2",
+		.input = { "abcdefghIjklmnopqrs", 19 },
+		.output = { false, 8 },
+	},
+	{
+		.description = "ASCII run, violation at byte 1 of word 2",
+		.input = { "abcdefghiJklmnopqrs", 19 },
+		.output = { false, 9 },
+	},
+	{
+		.description = "ASCII run, violation at byte 2 of word 2",
+		.input = { "abcdefghijKlmnopqrs", 19 },
+		.output = { false, 10 },
+	},
+	{
+		.description = "ASCII run, violation at byte 3 of word 2",
+		.input = { "abcdefghijkLmnopqrs", 19 },
+		.output = { false, 11 },
+	},
+	{
+		.description = "ASCII run, violation at byte 4 of word 2",
+		.input = { "abcdefghijklMnopqrs", 19 },
+		.output = { false, 12 },
+	},
+	{
+		.description = "ASCII run, violation at byte 5 of word 2",
+		.input = { "abcdefghijklmNopqrs", 19 },
+		.output = { false, 13 },
+	},
+	{
+		.description = "ASCII run, violation at byte 6 of word 2",
+		.input = { "abcdefghijklmnOpqrs", 19 },
+		.output = { false, 14 },
+	},
+	{
+		.description = "ASCII run, violation at byte 7 of word 2",
+		.input = { "abcdefghijklmnoPqrs", 19 },
+		.output = { false, 15 },
+	},
+	{
+		.description = "ASCII run, violation at byte 0 of the tail",
+		.input = { "abcdefghijklmnopQrs", 19 },
+		.output = { false, 16 },
+	},
+	{
+		.description = "ASCII run, violation at byte 1 of the tail",
+		.input = { "abcdefghijklmnopqRs", 19 },
+		.output = { false, 17 },
+	},
+	{
+		.description = "ASCII run, violation at byte 2 of the tail",
+		.input = { "abcdefghijklmnopqrS", 19 },
+		.output = { false, 18 },
+	},
+	{
+		.description = "ASCII run, full confirmation",
+		.input = { "abcdefghijklmnopqrs", 19 },
+		.output = { true, 19 },
+	},
+	{
+		.description = "ASCII run, full confirmation, NUL-terminated",
+		.input = { "abcdefghijklmnopqrs", SIZE_MAX },
+		.output = { true, 19 },
+	},
+	{
+		.description =
+			"ASCII run, violation in the tail, NUL-terminated",
+		.input = { "abcdefghijklmnopqRs", SIZE_MAX },
+		.output = { false, 17 },
+	},
+	{
+		.description = "ASCII run with NUL-byte, full confirmation",
+		.input = { "abcdefgh\0jklmnopqrs", 19 },
+		.output = { true, 19 },
+	},
+	{
+		.description =
+			"ASCII run, confirmation up to non-ASCII in word 1",
+		.input = { "abcdefg"
+	                   "\xC3\x9F"
+	                   "ijklmnopqrs", 20 },
+		.output = { true, 20 },
+	},
+	{
+		.description = "ASCII run, violation after non-ASCII in word 1",
+		.input = { "abcdefg"
+	                   "\xC3\x9F"
+	                   "Ijklmnopqrs", 20 },
+		.output = { false, 9 },
+	},
+	{
+		.description = "violation after non-ASCII at a word boundary",
+		.input = { "abcdefgh"
+	                   "\xC3\x9F"
+	                   "Jklmnopqrs", 20 },
+		.output = { false, 10 },
+	},
+	{
+		.description = "non-ASCII violation after an ASCII word",
+		.input = { "abcdefgh"
+	                   "\xC3\x80"
+	                   "jklmnopqrs", 20 },
+		.output = { false, 8 },
+	},
 };
 
 static const struct unit_test_is_case_utf8 is_uppercase_utf8[] = {
@@ -168,6 +376,139 @@ static const struct unit_test_is_case_utf8 is_uppercase_utf8[] = {
 		.input = { "HELLO", SIZE_MAX },
 		.output = { true, 5 },
 	},
+	{
+		.description = "ASCII run, violation at byte 0 of word 1",
+		.input = { "aBCDEFGHIJKLMNOPQRS", 19 },
+		.output = { false, 0 },
+	},
+	{
+		.description = "ASCII run, violation at byte 1 of word 1",
+		.input = { "AbCDEFGHIJKLMNOPQRS", 19 },
+		.output = { false, 1 },
+	},
+	{
+		.description = "ASCII run, violation at byte 2 of word 1",
+		.input = { "ABcDEFGHIJKLMNOPQRS", 19 },
+		.output = { false, 2 },
+	},
+	{
+		.description = "ASCII run, violation at byte 3 of word 1",
+		.input = { "ABCdEFGHIJKLMNOPQRS", 19 },
+		.output = { false, 3 },
+	},
+	{
+		.description = "ASCII run, violation at byte 4 of word 1",
+		.input = { "ABCDeFGHIJKLMNOPQRS", 19 },
+		.output = { false, 4 },
+	},
+	{
+		.description = "ASCII run, violation at byte 5 of word 1",
+		.input = { "ABCDEfGHIJKLMNOPQRS", 19 },
+		.output = { false, 5 },
+	},
+	{
+		.description = "ASCII run, violation at byte 6 of word 1",
+		.input = { "ABCDEFgHIJKLMNOPQRS", 19 },
+		.output = { false, 6 },
+	},
+	{
+		.description = "ASCII run, violation at byte 7 of word 1",
+		.input = { "ABCDEFGhIJKLMNOPQRS", 19 },
+		.output = { false, 7 },
+	},
+	{
+		.description = "ASCII run, violation at byte 0 of word 2",
+		.input = { "ABCDEFGHiJKLMNOPQRS", 19 },
+		.output = { false, 8 },
+	},
+	{
+		.description = "ASCII run, violation at byte 1 of word 2",
+		.input = { "ABCDEFGHIjKLMNOPQRS", 19 },
+		.output = { false, 9 },
+	},
+	{
+		.description = "ASCII run, violation at byte 2 of word 2",
+		.input = { "ABCDEFGHIJkLMNOPQRS", 19 },
+		.output = { false, 10 },
+	},
+	{
+		.description = "ASCII run, violation at byte 3 of word 2",
+		.input = { "ABCDEFGHIJKlMNOPQRS", 19 },
+		.output = { false, 11 },
+	},
+	{
+		.description = "ASCII run, violation at byte 4 of word 2",
+		.input = { "ABCDEFGHIJKLmNOPQRS", 19 },
+		.output = { false, 12 },
+	},
+	{
+		.description = "ASCII run, violation at byte 5 of word 2",
+		.input = { "ABCDEFGHIJKLMnOPQRS", 19 },
+		.output = { false, 13 },
+	},
+	{
+		.description = "ASCII run, violation at byte 6 of word 2",
+		.input = { "ABCDEFGHIJKLMNoPQRS", 19 },
+		.output = { false, 14 },
+	},
+	{
+		.description = "ASCII run, violation at byte 7 of word 2",
+		.input = { "ABCDEFGHIJKLMNOpQRS", 19 },
+		.output = { false, 15 },
+	},
+	{
+		.description = "ASCII run, violation at byte 0 of the tail",
+		.input = { "ABCDEFGHIJKLMNOPqRS", 19 },
+		.output = { false, 16 },
+	},
+	{
+		.description = "ASCII run, violation at byte 1 of the tail",
+		.input = { "ABCDEFGHIJKLMNOPQrS", 19 },
+		.output = { false, 17 },
+	},
+	{
+		.description = "ASCII run, violation at byte 2 of the tail",
+		.input = { "ABCDEFGHIJKLMNOPQRs", 19 },
+		.output = { false, 18 },
+	},
+	{
+		.description = "ASCII run, full confirmation",
+		.input = { "ABCDEFGHIJKLMNOPQRS", 19 },
+		.output = { true, 19 },
+	},
+	{
+		.description = "ASCII run, full confirmation, NUL-terminated",
+		.input = { "ABCDEFGHIJKLMNOPQRS", SIZE_MAX },
+		.output = { true, 19 },
+	},
+	{
+		.description =
+			"ASCII run, violation in the tail, NUL-terminated",
+		.input = { "ABCDEFGHIJKLMNOPQrS", SIZE_MAX },
+		.output = { false, 17 },
+	},
+	{
+		.description =
+			"ASCII run, confirmation up to non-ASCII in word 1",
+		.input = { "ABCDEFG"
+	                   "\xC3\x80"
+	                   "IJKLMNOPQRS", 20 },
+		.output = { true, 20 },
+	},
+	{
+		.description = "violation after non-ASCII at a word boundary",
+		.input = { "ABCDEFGH"
+	                   "\xC3\x80"
+	                   "jKLMNOPQRS", 20 },
+		.output = { false, 10 },
+	},
+	{
+		.description = "non-ASCII violation after an ASCII word",
+		.input = { "ABCDEFGH"
+	                   "\xC3\x9F"
+	                   "JKLMNOPQRS", 20 },
+		.output = { false, 8 },
+	},
 };
 
 static const struct unit_test_is_case_utf8 is_titlecase_utf8[] = {
@@ -272,6 +613,53 @@ static const struct unit_test_is_case_utf8 is_titlecase_utf8[] = {
 	                   SIZE_MAX },
 		.output = { true, 18 },
 	},
+	{
+		.description = "long words, full confirmation",
+		.input = { "Abcdefghijklmnop Qrstuvwxyz", 27 },
+		.output = { true, 27 },
+	},
+	{
+		.description = "long words, violation at the start of word 2",
+		.input = { "Abcdefghijklmnop qrstuvwxyz", 27 },
+		.output = { false, 17 },
+	},
+	{
+		.description = "long words, violation within word 2",
+		.input = { "Abcdefghijklmnop QrstuvwXyz", 27 },
+		.output = { false, 24 },
+	},
+	{
+		.description = "long word, violation after the first 8 bytes",
+		.input = { "AbcdefghiJklmnop", 16 },
+		.output = { false, 9 },
+	},
+	{
+		.description =
+			"short words within an ASCII word, full confirmation",
+		.input = { "Ab Cd Ef Gh Ij Kl", 17 },
+		.output = { true, 17 },
+	},
+	{
+		.description = "short words within an ASCII word, violation",
+		.input = { "Ab Cd eF Gh Ij Kl", 17 },
+		.output = { false, 6 },
+	},
+	{
+		.description =
+			"short words within an ASCII word, NUL-terminated",
+		.input = { "Ab Cd Ef Gh Ij Kl", SIZE_MAX },
+		.output = { true, 17 },
+	},
+	{
+		.description = "words separated by punctuation, confirmation",
+		.input = { "Ab,Cd;Ef", 8 },
+		.output = { true, 8 },
+	},
+	{
+		.description = "words separated by punctuation, violation",
+		.input = { "Ab-cD", 5 },
+		.output = { false, 3 },
+	},
 };
 
 static const struct unit_test_to_case_utf8 to_lowercase_utf8[] = {
@@ -542,6 +930,342 @@ static const struct unit_test_to_case_utf8 to_titlecase_utf8[] = {
 	},
 };
 
+static const struct unit_test_to_case_utf8 fold_case_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 10 },
+		.output = { "", 0 },
+	},
+	{
+		.description = "empty output",
+		.input = { "hello", 5, 0 },
+		.output = { "", 5 },
+	},
+	{
+		.description = "one word, conversion",
+		.input = { "wOrD", 4, 10 },
+		.output = { "word", 4 },
+	},
+	{
+		.description = "one word, conversion, truncation",
+		.input = { "wOrD", 4, 3 },
+		.output = { "wo", 4 },
+	},
+	{
+		.description = "one word, conversion, NUL-terminated",
+		.input = { "wOrD", SIZE_MAX, 10 },
+		.output = { "word", 4 },
+	},
+	{
+		.description = "sharp s",
+		.input = { "Stra\xC3\x9F"
+		           "e",
+		           7, 10 },
+		.output = { "strasse", 7 },
+	},
+	{
+		.description = "dotless i",
+		.input = { "I\xC4\xB1", 3, 10 },
+		.output = { "i\xC4\xB1", 3 },
+	},
+	{
+		.description = "Cherokee, folded to uppercase",
+		.input = { "\xEA\xAD\xB0\xE1\x8E\xA0\xE1\x8F\xB8", 9, 10 },
+		.output = { "\xE1\x8E\xA0\xE1\x8E\xA0\xE1\x8F\xB0", 9 },
+	},
+	{
+		.description = "capital sharp s",
+		.input = { "\xE1\xBA\x9E", 3, 10 },
+		.output = { "ss", 2 },
+	},
+	{
+		.description = "final sigma",
+		.input = { "\xCE\xA3\xCF\x82", 4, 10 },
+		.output = { "\xCF\x83\xCF\x83", 4 },
+	},
+	{
+		.description = "ligature, truncation",
+		.input = { "\xEF\xAC\x83", 3, 3 },
+		.output = { "ff", 3 },
+	},
+};
+
+static const struct unit_test_to_case_inplace_utf8 to_lowercase_inplace_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0 },
+		.output = { "", 0 },
+	},
+	{
+		.description = "empty input, NUL-terminated",
+		.input = { "", SIZE_MAX },
+		.output = { "", 0 },
+	},
+	{
+		.description = "ASCII input",
+		.input = { "Hello World", 11 },
+		.output = { "hello world", 11 },
+	},
+	{
+		.description = "ASCII input, NUL-terminated",
+		.input = { "HELLO", SIZE_MAX },
+		.output = { "hello", 5 },
+	},
+	{
+		.description = "ASCII input, limited length",
+		.input = { "HELLO", 3 },
+		.output = { "helLO", 3 },
+	},
+	{
+		.description = "final and non-final sigmas",
+		.input = { "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 "
+		           "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3",
+		           17 },
+		.output = { "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82 "
+		            "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82",
+		            17 },
+	},
+	{
+		.description = "sigma before a length-changing character",
+		.input = { "\xCE\x91\xCE\xA3\xC4\xB0", 6 },
+		.output = { "\xCE\xB1\xCF\x83\xC4\xB0", 4 },
+	},
+	{
+		.description = "character with longer lowercase",
+		.input = { "AB\xC8\xBA" "C", 5 },
+		.output = { "ab\xC8\xBA" "C", 2 },
+	},
+	{
+		.description = "invalid UTF-8",
+		.input = { "A\xFF" "B", 3 },
+		.output = { "a\xFF" "B", 1 },
+	},
+};
+
+static const struct unit_test_to_case_inplace_utf8 to_uppercase_inplace_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0 },
+		.output = { "", 0 },
+	},
+	{
+		.description = "ASCII input",
+		.input = { "Hello World", 11 },
+		.output = { "HELLO WORLD", 11 },
+	},
+	{
+		.description = "ASCII input, NUL-terminated",
+		.input = { "abc", SIZE_MAX },
+		.output = { "ABC", 3 },
+	},
+	{
+		.description = "special case of the same length",
+		.input = { "stra\xC3\x9F" "e", 7 },
+		.output = { "STRASSE", 7 },
+	},
+	{
+		.description = "special case of shorter length",
+		.input = { "a\xEF\xAC\x80" "b", 5 },
+		.output = { "A\xEF\xAC\x80" "b", 1 },
+	},
+};
+
+static const struct unit_test_to_case_batch_utf8 to_lowercase_batch_utf8[] = {
+	{
+		.description = "no strings",
+		.input = { { NULL }, { 0 }, 0, 10 },
+		.output = { "", 0, { 0 } },
+	},
+	{
+		.description = "no strings, no output",
+		.input = { { NULL }, { 0 }, 0, 0 },
+		.output = { "", 0, { 0 } },
+	},
+	{
+		.description = "empty strings",
+		.input = { { "", "" }, { 0, SIZE_MAX }, 2, 10 },
+		.output = { "", 0, { 0, 0 } },
+	},
+	{
+		.description = "ASCII strings",
+		.input = { { "Tag", "KEY", "value" }, { 3, 3, 5 }, 3, 20 },
+		.output = { "tagkeyvalue", 11, { 3, 6, 11 } },
+	},
+	{
+		.description = "ASCII strings, NUL-terminated",
+		.input = { { "Tag", "KEY", "value" },
+		           { SIZE_MAX, SIZE_MAX, SIZE_MAX },
+		           3,
+		           20 },
+		.output = { "tagkeyvalue", 11, { 3, 6, 11 } },
+	},
+	{
+		.description = "ASCII strings, limited lengths",
+		.input = { { "Tag", "KEY", "value" }, { 2, 1, 0 }, 3, 20 },
+		.output = { "tak", 3, { 2, 3, 3 } },
+	},
+	{
+		.description = "ASCII strings, no output",
+		.input = { { "Tag", "KEY", "value" }, { 3, 3, 5 }, 3, 0 },
+		.output = { "", 11, { 3, 6, 11 } },
+	},
+	{
+		.description = "ASCII strings, truncated output",
+		.input = { { "Tag", "KEY", "value" }, { 3, 3, 5 }, 3, 5 },
+		.output = { "tagk", 11, { 3, 6, 11 } },
+	},
+	{
+		.description = "sigma at the end of each string",
+		.input = { { "\xCE\x91\xCE\xA3", "\xCE\xA3\xCE\x91" },
+		           { 4, 4 },
+		           2,
+		           20 },
+		.output = { "\xCE\xB1\xCF\x82\xCF\x83\xCE\xB1",
+		            8,
+		            { 4, 8 } },
+	},
+	{
+		.description = "character with longer lowercase",
+		.input = { { "A\xC8\xBA", "B" }, { 3, 1 }, 2, 20 },
+		.output = { "a\xE2\xB1\xA5" "b", 5, { 4, 5 } },
+	},
+};
+
+static const struct unit_test_to_case_batch_utf8 to_uppercase_batch_utf8[] = {
+	{
+		.description = "ASCII strings",
+		.input = { { "Tag", "KEY", "value" }, { 3, 3, 5 }, 3, 20 },
+		.output = { "TAGKEYVALUE", 11, { 3, 6, 11 } },
+	},
+	{
+		.description = "special case",
+		.input = { { "stra\xC3\x9F" "e", "x" }, { 7, 1 }, 2, 20 },
+		.output = { "STRASSEX", 8, { 7, 8 } },
+	},
+	{
+		.description = "special case, no output",
+		.input = { { "stra\xC3\x9F" "e", "x" }, { 7, 1 }, 2, 0 },
+		.output = { "", 8, { 7, 8 } },
+	},
+};
+
+static const struct unit_test_caseless_compare_utf8 caseless_compare_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, "", 0 },
+		.output = { 0 },
+	},
+	{
+		.description = "NULL input",
+		.input = { NULL, 0, "", SIZE_MAX },
+		.output = { 0 },
+	},
+	{
+		.description = "equal",
+		.input = { "Content-Type", 12, "content-type", 12 },
+		.output = { 0 },
+	},
+	{
+		.description = "equal, NUL-terminated",
+		.input = { "Content-Type", SIZE_MAX, "CONTENT-TYPE", SIZE_MAX },
+		.output = { 0 },
+	},
+	{
+		.description = "smaller",
+		.input = { "Content-Length", 14, "content-type", 12 },
+		.output = { -1 },
+	},
+	{
+		.description = "greater",
+		.input = { "Content-Type", 12, "content-length", 14 },
+		.output = { 1 },
+	},
+	{
+		.description = "prefix",
+		.input = { "Content", 7, "content-type", 12 },
+		.output = { -1 },
+	},
+	{
+		.description = "prefix, NUL-terminated",
+		.input = { "Content-Type", SIZE_MAX, "content", SIZE_MAX },
+		.output = { 1 },
+	},
+	{
+		.description = "sharp s",
+		.input = { "STRASSE", 7,
+		           "stra\xC3\x9F"
+		           "e",
+		           7 },
+		.output = { 0 },
+	},
+	{
+		.description = "sharp s, difference after expansion",
+		.input = { "\xC3\x9F", 2, "st", 2 },
+		.output = { -1 },
+	},
+	{
+		.description = "final sigma",
+		.input = { "\xCE\xA3\xCE\xA3", 4, "\xCF\x83\xCF\x82", 4 },
+		.output = { 0 },
+	},
+	{
+		.description = "dotless i",
+		.input = { "\xC4\xB1", 2, "I", 1 },
+		.output = { 1 },
+	},
+	{
+		.description = "Cherokee",
+		.input = { "\xEA\xAD\xB0", 3, "\xE1\x8E\xA0", 3 },
+		.output = { 0 },
+	},
+};
+
+static const struct unit_test_caseless_hash_utf8 caseless_hash_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, 0, NULL, 0, 0 },
+		.output = { true },
+	},
+	{
+		.description = "equal",
+		.input = { "Content-Type", 12, 0, "content-type", 12, 0 },
+		.output = { true },
+	},
+	{
+		.description = "equal, NUL-terminated",
+		.input = { "Content-Type", SIZE_MAX, 0, "CONTENT-TYPE", 12, 0 },
+		.output = { true },
+	},
+	{
+		.description = "different",
+		.input = { "Content-Type", 12, 0, "Content-Typo", 12, 0 },
+		.output = { false },
+	},
+	{
+		.description = "prefix",
+		.input = { "Content-Type", 12, 0, "Content-Typ", 11, 0 },
+		.output = { false },
+	},
+	{
+		.description = "different seeds",
+		.input = { "Content-Type", 12, 0, "Content-Type", 12, 1 },
+		.output = { false },
+	},
+	{
+		.description = "sharp s",
+		.input = { "STRASSE", 7, 0,
+		           "stra\xC3\x9F"
+		           "e",
+		           7, 0 },
+		.output = { true },
+	},
+	{
+		.description = "final sigma",
+		.input = { "\xCE\xA3\xCE\xA3", 4, 0, "\xCF\x83\xCF\x82", 4, 0 },
+		.output = { true },
+	},
+};
+
 static int
 unit_test_callback_is_case_utf8(const void *t, size_t off, const char *name,
                                 const char *argv0)
@@ -605,6 +1329,10 @@ unit_test_callback_to_case_utf8(const void *t, size_t off, const char *name,
 		ret = grapheme_to_titlecase_utf8(test->input.src,
 		                                 test->input.srclen, buf,
 		                                 test->input.destlen);
+	} else if (t == fold_case_utf8) {
+		ret = grapheme_fold_case_utf8(test->input.src,
+		                              test->input.srclen, buf,
+		                              test->input.destlen);
 	} else {
 		goto err;
 	}
@@ -633,6 +1361,169 @@ err:
 	return 1;
 }
 
+static int
+unit_test_callback_to_case_inplace_utf8(const void *t, size_t off,
+                                        const char *name, const char *argv0)
+{
+	const struct unit_test_to_case_inplace_utf8 *test =
+		(const struct unit_test_to_case_inplace_utf8 *)t + off;
+	size_t ret = 0, len, i;
+	char buf[512];
+
+	/* fill the array with canary values and copy the input */
+	memset(buf, 0x7f, LEN(buf));
+	len = strlen(test->input.str) + 1;
+	memcpy(buf, test->input.str, len);
+
+	if (t == to_lowercase_inplace_utf8) {
+		ret = grapheme_to_lowercase_inplace_utf8(buf, test->input.len);
+	} else if (t == to_uppercase_inplace_utf8) {
+		ret = grapheme_to_uppercase_inplace_utf8(buf, test->input.len);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret || memcmp(buf, test->output.str, len)) {
+		goto err;
+	}
+
+	/* check that none of the canary values have been overwritten */
+	for (i = len; i < LEN(buf); i++) {
+		if (buf[i] != 0x7f) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned (\"%s\", %zu) instead of (\"%s\", %zu)).\n",
+	        argv0, name, off, test->description, buf, ret,
+	        test->output.str, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_to_case_batch_utf8(const void *t, size_t off,
+                                      const char *name, const char *argv0)
+{
+	const struct unit_test_to_case_batch_utf8 *test =
+		(const struct unit_test_to_case_batch_utf8 *)t + off;
+	size_t ret = 0, ends[3], i;
+	char buf[512];
+
+	/* fill the arrays with canary values */
+	memset(buf, 0x7f, LEN(buf));
+	for (i = 0; i < LEN(ends); i++) {
+		ends[i] = SIZE_MAX;
+	}
+
+	if (t == to_lowercase_batch_utf8) {
+		ret = grapheme_to_lowercase_batch_utf8(
+			test->input.src, test->input.srclen, test->input.count,
+			buf, test->input.destlen, ends);
+	} else if (t == to_uppercase_batch_utf8) {
+		ret = grapheme_to_uppercase_batch_utf8(
+			test->input.src, test->input.srclen, test->input.count,
+			buf, test->input.destlen, ends);
+	} else {
+		goto err;
+	}
+
+	/* check results */
+	if (ret != test->output.ret ||
+	    memcmp(buf, test->output.dest,
+	           MIN(test->input.destlen, strlen(test->output.dest) + 1))) {
+		goto err;
+	}
+	for (i = 0; i < test->input.count; i++) {
+		if (ends[i] != test->output.ends[i]) {
+			goto err;
+		}
+	}
+
+	/* check that none of the canary values have been overwritten */
+	for (i = test->input.destlen; i < LEN(buf); i++) {
+		if (buf[i] != 0x7f) {
+			goto err;
+		}
+	}
+	for (i = test->input.count; i < LEN(ends); i++) {
+		if (ends[i] != SIZE_MAX) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned (\"%.*s\", %zu) instead of (\"%s\", %zu)).\n",
+	        argv0, name, off, test->description,
+	        (int)MIN(ret, test->input.destlen), buf, ret,
+	        test->output.dest, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_caseless_compare_utf8(const void *t, size_t off,
+                                         const char *name, const char *argv0)
+{
+	const struct unit_test_caseless_compare_utf8 *test =
+		(const struct unit_test_caseless_compare_utf8 *)t + off;
+	int ret, rev;
+
+	ret = grapheme_caseless_compare_utf8(test->input.a, test->input.alen,
+	                                     test->input.b, test->input.blen);
+	rev = grapheme_caseless_compare_utf8(test->input.b, test->input.blen,
+	                                     test->input.a, test->input.alen);
+
+	/* check results, also with swapped arguments */
+	if (ret != test->output.ret || rev != -test->output.ret) {
+		goto err;
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned (%d, %d) instead of (%d, %d)).\n",
+	        argv0, name, off, test->description, ret, rev,
+	        test->output.ret, -test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_caseless_hash_utf8(const void *t, size_t off,
+                                      const char *name, const char *argv0)
+{
+	const struct unit_test_caseless_hash_utf8 *test =
+		(const struct unit_test_caseless_hash_utf8 *)t + off;
+	uint_least64_t a, b;
+
+	a = grapheme_caseless_hash_utf8(test->input.a, test->input.alen,
+	                                test->input.aseed);
+	b = grapheme_caseless_hash_utf8(test->input.b, test->input.blen,
+	                                test->input.bseed);
+
+	/* check results */
+	if ((a == b) != test->output.equal) {
+		goto err;
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(hashes are %s instead of %s).\n",
+	        argv0, name, off, test->description,
+	        (a == b) ? "equal" : "different",
+	        test->output.equal ? "equal" : "different");
+	return 1;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -655,5 +1546,30 @@ main(int argc, char *argv[])
 	                      "grapheme_to_uppercase_utf8", argv[0]) +
 	       run_unit_tests(unit_test_callback_to_case_utf8,
 	                      to_titlecase_utf8, LEN(to_titlecase_utf8),
-	                      "grapheme_to_titlecase_utf8", argv[0]);
+	                      "grapheme_to_titlecase_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_to_case_inplace_utf8,
+	                      to_lowercase_inplace_utf8,
+	                      LEN(to_lowercase_inplace_utf8),
+	                      "grapheme_to_lowercase_inplace_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_to_case_inplace_utf8,
+	                      to_uppercase_inplace_utf8,
+	                      LEN(to_uppercase_inplace_utf8),
+	                      "grapheme_to_uppercase_inplace_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_to_case_batch_utf8,
+	                      to_lowercase_batch_utf8,
+	                      LEN(to_lowercase_batch_utf8),
+	                      "grapheme_to_lowercase_batch_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_to_case_batch_utf8,
+	                      to_uppercase_batch_utf8,
+	                      LEN(to_uppercase_batch_utf8),
+	                      "grapheme_to_uppercase_batch_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_to_case_utf8, fold_case_utf8,
+	                      LEN(fold_case_utf8), "grapheme_fold_case_utf8",
+	                      argv[0]) +
+	       run_unit_tests(unit_test_callback_caseless_compare_utf8,
+	                      caseless_compare_utf8, LEN(caseless_compare_utf8),
+	                      "grapheme_caseless_compare_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_caseless_hash_utf8,
+	                      caseless_hash_utf8, LEN(caseless_hash_utf8),
+	                      "grapheme_caseless_hash_utf8", argv[0]);
 }
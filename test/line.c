@@ -1,6 +1,7 @@
 /* See LICENSE file for copyright and license details. */
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #include "../gen/line-test.h"
 #include "../grapheme.h"
@@ -90,6 +91,255 @@ static const struct unit_test_next_break_utf8 next_line_break_utf8[] = {
 	},
 };
 
+struct unit_test_wrap_line_utf8 {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t columns;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t linelen;
+	} output;
+};
+
+static const struct unit_test_wrap_line_utf8 wrap_line_utf8[] = {
+	{
+		.description = "NULL input",
+		.input = { NULL, 0, 10 },
+		.output = { 0, 0 },
+	},
+	{
+		.description = "empty input",
+		.input = { "", 0, 10 },
+		.output = { 0, 0 },
+	},
+	{
+		.description = "fitting input",
+		.input = { "hello world", 11, 11 },
+		.output = { 11, 11 },
+	},
+	{
+		.description = "wrapped input",
+		.input = { "hello world", 11, 8 },
+		.output = { 6, 5 },
+	},
+	{
+		.description = "wrapped input, NUL-terminated",
+		.input = { "hello world", SIZE_MAX, 8 },
+		.output = { 6, 5 },
+	},
+	{
+		.description = "hanging spaces",
+		.input = { "hello   world", 13, 5 },
+		.output = { 8, 5 },
+	},
+	{
+		.description = "mandatory break",
+		.input = { "ab\ncd", 5, 10 },
+		.output = { 3, 2 },
+	},
+	{
+		.description = "mandatory break, CRLF",
+		.input = { "ab\r\ncd", 6, 10 },
+		.output = { 4, 2 },
+	},
+	{
+		.description = "overlong word",
+		.input = { "abcdefgh", 8, 3 },
+		.output = { 3, 3 },
+	},
+	{
+		.description = "overlong word, zero columns",
+		.input = { "ab", 2, 0 },
+		.output = { 1, 1 },
+	},
+	{
+		.description = "single character, zero columns",
+		.input = { "a", 1, 0 },
+		.output = { 1, 1 },
+	},
+	{
+		.description = "wide character wider than the line",
+		.input = { "\xE4\xB8\x96", 3, 1 },
+		.output = { 3, 3 },
+	},
+	{
+		.description = "wide characters",
+		.input = { "\xE4\xB8\x96\xE7\x95\x8C\xE4\xB8\x96\xE7\x95\x8C",
+		           12, 5 },
+		.output = { 6, 6 },
+	},
+	{
+		.description = "combining marks",
+		.input = { "e\xCC\x81"
+		           "e\xCC\x81"
+		           "e\xCC\x81 x",
+		           11, 3 },
+		.output = { 10, 9 },
+	},
+	{
+		.description = "overlong word, combining marks",
+		.input = { "e\xCC\x81"
+		           "e\xCC\x81"
+		           "e\xCC\x81",
+		           9, 2 },
+		.output = { 6, 6 },
+	},
+	{
+		.description = "wide character, no columns",
+		.input = { "\xE4\xB8\x96x", 4, 0 },
+		.output = { 3, 3 },
+	},
+};
+
+struct unit_test_wrap_paragraph_utf8 {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		size_t columns;
+		size_t buflen;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t end[4];
+	} output;
+};
+
+static const struct unit_test_wrap_paragraph_utf8 wrap_paragraph_utf8[] = {
+	{
+		.description = "NULL input",
+		.input = { NULL, 0, 10, 64 },
+		.output = { 0, { 0 } },
+	},
+	{
+		.description = "fitting input",
+		.input = { "hello world", 11, 20, 64 },
+		.output = { 1, { 11 } },
+	},
+	{
+		.description = "fitting input, NUL-terminated",
+		.input = { "hello world", SIZE_MAX, 20, 64 },
+		.output = { 1, { 11 } },
+	},
+	{
+		.description = "balanced lines",
+		.input = { "aaa bb cc ddddd", 15, 6, 64 },
+		.output = { 3, { 4, 10, 15 } },
+	},
+	{
+		.description = "mandatory break",
+		.input = { "ab cd\nef", 8, 10, 64 },
+		.output = { 1, { 6 } },
+	},
+	{
+		.description = "overlong word",
+		.input = { "abcdefgh ij", 11, 3, 64 },
+		.output = { 4, { 3, 6, 9, 11 } },
+	},
+	{
+		.description = "buffer too small",
+		.input = { "ab cd", 5, 10, 8 },
+		.output = { 21, { 0 } },
+	},
+	{
+		.description = "buffer too small, no buffer",
+		.input = { "aaa bb cc ddddd", 15, 6, 0 },
+		.output = { 35, { 0 } },
+	},
+	{
+		.description = "buffer just large enough",
+		.input = { "aaa bb cc ddddd", 15, 6, 35 },
+		.output = { 3, { 4, 10, 15 } },
+	},
+	{
+		.description = "wide characters, zero columns",
+		.input = { "\xE4\xB8\x96\xE4\xB8\x96", 6, 0, 64 },
+		.output = { 2, { 3, 6 } },
+	},
+	{
+		.description = "wide character, no columns",
+		.input = { "\xE4\xB8\x96x", 4, 0, 64 },
+		.output = { 2, { 3, 4 } },
+	},
+};
+
+struct unit_test_wrap_update_utf8 {
+	const char *description;
+
+	struct {
+		const char *old;
+		size_t oldsrclen;
+		const char *src;
+		size_t srclen;
+		size_t columns;
+		size_t off;
+		size_t oldlen;
+		size_t newlen;
+		size_t buflen;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t end[5];
+	} output;
+};
+
+static const struct unit_test_wrap_update_utf8 wrap_update_utf8[] = {
+	{
+		.description = "empty input",
+		.input = { "", 0, "", 0, 5, 0, 0, 0, 64 },
+		.output = { 0, { 0 } },
+	},
+	{
+		.description = "unchanged wrapping",
+		.input = { "aaaa bbbb cccc dddd", 19, "aaaa bbbb xccc dddd", 19, 5,
+		           10, 1, 1, 64 },
+		.output = { 4, { 5, 10, 15, 19 } },
+	},
+	{
+		.description = "shortened word",
+		.input = { "aaaa bbbb cccc dddd", 19, "aaaa bb cccc dddd", 17, 5,
+		           5, 4, 2, 64 },
+		.output = { 4, { 5, 8, 13, 17 } },
+	},
+	{
+		.description = "inserted line",
+		.input = { "aaaa bbbb cccc dddd", 19, "aaaa xx bbbb cccc dddd", 22,
+		           5, 5, 0, 3, 64 },
+		.output = { 5, { 5, 8, 13, 18, 22 } },
+	},
+	{
+		.description = "removed line",
+		.input = { "aaaa bbbb cccc dddd", 19, "bbbb cccc dddd", 14, 5, 0,
+		           5, 0, 64 },
+		.output = { 3, { 5, 10, 14 } },
+	},
+	{
+		.description = "appended line",
+		.input = { "aaaa bbbb cccc dddd", 19, "aaaa bbbb cccc dddd eeee",
+		           24, 5, 19, 0, 5, 64 },
+		.output = { 5, { 5, 10, 15, 20, 24 } },
+	},
+	{
+		.description = "merged lines",
+		.input = { "aa bbbb cc", 10, "aa b cc", 7, 5, 3, 4, 1, 64 },
+		.output = { 2, { 5, 7 } },
+	},
+	{
+		.description = "buffer too small",
+		.input = { "aaaa bbbb cccc dddd", 19, "aaaa xx bbbb cccc dddd", 22,
+		           5, 5, 0, 3, 4 },
+		.output = { 5, { 5, 8 } },
+	},
+};
+
 static int
 unit_test_callback_next_line_break(const void *t, size_t off, const char *name,
                                    const char *argv0)
@@ -106,6 +356,97 @@ unit_test_callback_next_line_break_utf8(const void *t, size_t off,
 		t, off, grapheme_next_line_break_utf8, name, argv0);
 }
 
+static int
+unit_test_callback_wrap_line_utf8(const void *t, size_t off, const char *name,
+                                  const char *argv0)
+{
+	const struct unit_test_wrap_line_utf8 *test =
+		(const struct unit_test_wrap_line_utf8 *)t + off;
+	size_t ret, linelen = 0x7f;
+
+	ret = grapheme_wrap_line_utf8(test->input.src, test->input.srclen,
+	                              test->input.columns, &linelen);
+
+	/* check results */
+	if (ret != test->output.ret || linelen != test->output.linelen) {
+		fprintf(stderr,
+		        "%s: %s: Failed unit test %zu \"%s\" "
+		        "(returned (%zu, %zu) instead of (%zu, %zu)).\n",
+		        argv0, name, off, test->description, ret, linelen,
+		        test->output.ret, test->output.linelen);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int
+unit_test_callback_wrap_paragraph_utf8(const void *t, size_t off,
+                                       const char *name, const char *argv0)
+{
+	const struct unit_test_wrap_paragraph_utf8 *test =
+		(const struct unit_test_wrap_paragraph_utf8 *)t + off;
+	size_t buf[64], ret, i;
+
+	ret = grapheme_wrap_paragraph_utf8(test->input.src, test->input.srclen,
+	                                   test->input.columns, buf,
+	                                   test->input.buflen);
+
+	/* check results */
+	if (ret != test->output.ret) {
+		goto err;
+	}
+	for (i = 0; ret <= test->input.buflen && i < ret; i++) {
+		if (buf[i] != test->output.end[i]) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu lines or wrong line ends).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+static int
+unit_test_callback_wrap_update_utf8(const void *t, size_t off,
+                                    const char *name, const char *argv0)
+{
+	const struct unit_test_wrap_update_utf8 *test =
+		(const struct unit_test_wrap_update_utf8 *)t + off;
+	size_t buf[64], nlines, ret, i;
+
+	/* wrap the old text from scratch and then update it */
+	nlines = grapheme_wrap_update_utf8(
+		test->input.old, test->input.oldsrclen, test->input.columns, 0,
+		0, test->input.oldsrclen, buf, test->input.buflen, 0);
+	ret = grapheme_wrap_update_utf8(
+		test->input.src, test->input.srclen, test->input.columns,
+		test->input.off, test->input.oldlen, test->input.newlen, buf,
+		test->input.buflen, nlines);
+
+	/* check results */
+	if (ret != test->output.ret) {
+		goto err;
+	}
+	for (i = 0; i < ret && i < test->input.buflen / 2; i++) {
+		if (buf[2 * i] != test->output.end[i]) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu lines or wrong line ends).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -118,5 +459,14 @@ main(int argc, char *argv[])
 	                      "grapheme_next_line_break", argv[0]) +
 	       run_unit_tests(unit_test_callback_next_line_break_utf8,
 	                      next_line_break_utf8, LEN(next_line_break_utf8),
-	                      "grapheme_next_line_break_utf8", argv[0]);
+	                      "grapheme_next_line_break_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_wrap_line_utf8,
+	                      wrap_line_utf8, LEN(wrap_line_utf8),
+	                      "grapheme_wrap_line_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_wrap_paragraph_utf8,
+	                      wrap_paragraph_utf8, LEN(wrap_paragraph_utf8),
+	                      "grapheme_wrap_paragraph_utf8", argv[0]) +
+	       run_unit_tests(unit_test_callback_wrap_update_utf8,
+	                      wrap_update_utf8, LEN(wrap_update_utf8),
+	                      "grapheme_wrap_update_utf8", argv[0]);
 }
@@ -0,0 +1,310 @@
+/* See LICENSE file for copyright and license details. */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../gen/character-test.h"
+#include "../gen/line-test.h"
+#include "../gen/sentence-test.h"
+#include "../gen/word-test.h"
+#include "../grapheme.h"
+#include "util.h"
+
+#define CONCATENATION_LEN           8192
+#define CONCATENATION_PARAGRAPH_LEN 2048
+
+#define ALL_SEGMENTATIONS                                              \
+	(GRAPHEME_SEGMENTATION_CHARACTER | GRAPHEME_SEGMENTATION_WORD | \
+	 GRAPHEME_SEGMENTATION_SENTENCE | GRAPHEME_SEGMENTATION_LINE)
+
+struct unit_test_segment_utf8 {
+	const char *description;
+
+	struct {
+		const char *src;
+		size_t srclen;
+		unsigned int segmentations;
+	} input;
+
+	struct {
+		size_t ret;
+		size_t count[4];
+	} output;
+};
+
+static const struct unit_test_segment_utf8 segment_utf8[] = {
+	{
+		.description = "NULL input",
+		.input = { NULL, 0, ALL_SEGMENTATIONS },
+		.output = { 0, { 0, 0, 0, 0 } },
+	},
+	{
+		.description = "empty input",
+		.input = { "", 0, ALL_SEGMENTATIONS },
+		.output = { 0, { 0, 0, 0, 0 } },
+	},
+	{
+		.description = "empty input, NUL-terminated",
+		.input = { "", SIZE_MAX, ALL_SEGMENTATIONS },
+		.output = { 0, { 0, 0, 0, 0 } },
+	},
+	{
+		.description = "two paragraphs",
+		.input = { "Hello world. Bye!\nNext", 22, ALL_SEGMENTATIONS },
+		.output = { 22, { 22, 9, 3, 4 } },
+	},
+	{
+		.description = "two paragraphs, NUL-terminated",
+		.input = { "Hello world. Bye!\nNext", SIZE_MAX,
+		           ALL_SEGMENTATIONS },
+		.output = { 22, { 22, 9, 3, 4 } },
+	},
+	{
+		.description = "two paragraphs, words only",
+		.input = { "Hello world. Bye!\nNext", 22,
+		           GRAPHEME_SEGMENTATION_WORD },
+		.output = { 22, { SIZE_MAX, 9, SIZE_MAX, SIZE_MAX } },
+	},
+	{
+		.description = "carriage return and line feed",
+		.input = { "a\r\nb\rc", 6, ALL_SEGMENTATIONS },
+		.output = { 6, { 5, 5, 3, 3 } },
+	},
+	{
+		.description = "combining marks and regional indicators",
+		.input = { "e\xCC\x81"
+		           "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA",
+		           11, ALL_SEGMENTATIONS },
+		.output = { 11, { 2, 2, 1, 2 } },
+	},
+};
+
+static int
+unit_test_callback_segment_utf8(const void *t, size_t off, const char *name,
+                                const char *argv0)
+{
+	const struct unit_test_segment_utf8 *test =
+		(const struct unit_test_segment_utf8 *)t + off;
+	struct grapheme_segmentation seg[4];
+	size_t ret, i;
+
+	for (i = 0; i < LEN(seg); i++) {
+		seg[i].count = SIZE_MAX;
+		seg[i].ends = NULL;
+		seg[i].endslen = 0;
+	}
+
+	ret = grapheme_segment_utf8(test->input.src, test->input.srclen,
+	                            test->input.segmentations, seg);
+
+	/* check results */
+	if (ret != test->output.ret) {
+		goto err;
+	}
+	for (i = 0; i < LEN(seg); i++) {
+		if (seg[i].count != test->output.count[i]) {
+			goto err;
+		}
+	}
+
+	return 0;
+err:
+	fprintf(stderr,
+	        "%s: %s: Failed unit test %zu \"%s\" "
+	        "(returned %zu instead of %zu or wrong segment counts).\n",
+	        argv0, name, off, test->description, ret, test->output.ret);
+	return 1;
+}
+
+/*
+ * the fused segmentation is checked against the conformance tests by
+ * having it return the first segment only
+ */
+static size_t
+first_segment(const uint_least32_t *str, size_t len,
+              enum grapheme_segmentation_type type, size_t index)
+{
+	struct grapheme_segmentation seg[4];
+	size_t end = 0;
+
+	seg[index].ends = &end;
+	seg[index].endslen = 1;
+	(void)grapheme_segment(str, len, type, seg);
+
+	return end;
+}
+
+static size_t
+segment_next_character_break(const uint_least32_t *str, size_t len)
+{
+	return first_segment(str, len, GRAPHEME_SEGMENTATION_CHARACTER, 0);
+}
+
+static size_t
+segment_next_word_break(const uint_least32_t *str, size_t len)
+{
+	return first_segment(str, len, GRAPHEME_SEGMENTATION_WORD, 1);
+}
+
+static size_t
+segment_next_sentence_break(const uint_least32_t *str, size_t len)
+{
+	return first_segment(str, len, GRAPHEME_SEGMENTATION_SENTENCE, 2);
+}
+
+static size_t (*const next_break[])(const uint_least32_t *, size_t) = {
+	grapheme_next_character_break,
+	grapheme_next_word_break,
+	grapheme_next_sentence_break,
+	grapheme_next_line_break,
+};
+
+static size_t (*const next_break_utf8[])(const char *, size_t) = {
+	grapheme_next_character_break_utf8,
+	grapheme_next_word_break_utf8,
+	grapheme_next_sentence_break_utf8,
+	grapheme_next_line_break_utf8,
+};
+
+static int
+check_segmentation(const uint_least32_t *cp, size_t cplen, size_t index)
+{
+	static char str[4 * CONCATENATION_LEN];
+	static size_t ends[CONCATENATION_LEN];
+	struct grapheme_segmentation seg[4];
+	size_t i, len, off, count;
+
+	seg[index].ends = ends;
+	seg[index].endslen = LEN(ends);
+
+	/* the segment ends must be the breaks of the break function */
+	if (grapheme_segment(cp, cplen, 1U << index, seg) != cplen) {
+		return 1;
+	}
+	for (off = 0, count = 0; off < cplen; count++) {
+		off += next_break[index](cp + off, cplen - off);
+		if (count == seg[index].count || ends[count] != off) {
+			return 1;
+		}
+	}
+	if (count != seg[index].count) {
+		return 1;
+	}
+
+	/* the same goes for the UTF-8-encoded input */
+	for (i = 0, len = 0; i < cplen; i++) {
+		len += grapheme_encode_utf8(cp[i], str + len, LEN(str) - len);
+	}
+	if (grapheme_segment_utf8(str, len, 1U << index, seg) != len) {
+		return 1;
+	}
+	for (off = 0, count = 0; off < len; count++) {
+		off += next_break_utf8[index](str + off, len - off);
+		if (count == seg[index].count || ends[count] != off) {
+			return 1;
+		}
+	}
+	if (count != seg[index].count) {
+		return 1;
+	}
+
+	return 0;
+}
+
+static bool
+has_paragraph_separator(const struct break_test *test)
+{
+	size_t i;
+
+	for (i = 0; i < test->cplen; i++) {
+		if (test->cp[i] == 0x000A || test->cp[i] == 0x000D ||
+		    test->cp[i] == 0x0085 || test->cp[i] == 0x2028 ||
+		    test->cp[i] == 0x2029) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * the fused segmentation of codepoint and UTF-8 input is checked
+ * against the break functions on each conformance test and on the
+ * concatenated tests, where we leave out the paragraph separators of
+ * the tests and instead separate paragraphs that are too long to be
+ * decoded at once
+ */
+static int
+run_segmentation_tests(const struct break_test *test, size_t testlen,
+                       size_t index, const char *name, const char *argv0)
+{
+	static uint_least32_t concatenation[CONCATENATION_LEN];
+	size_t i, j, len, parlen, num_tests, failed;
+
+	for (i = 0, num_tests = 0, failed = 0; i < testlen; i++, num_tests++) {
+		if (check_segmentation(test[i].cp, test[i].cplen, index)) {
+			fprintf(stderr,
+			        "%s: %s: Failed conformance test %zu \"%s\".\n",
+			        argv0, name, i, test[i].descr);
+			failed++;
+		}
+	}
+	for (i = 0; i < testlen; num_tests++) {
+		for (len = 0, parlen = 0;
+		     i < testlen &&
+		     len + test[i].cplen + 1 <= LEN(concatenation);
+		     i++) {
+			if (has_paragraph_separator(&test[i])) {
+				continue;
+			}
+			for (j = 0; j < test[i].cplen; j++) {
+				concatenation[len++] = test[i].cp[j];
+			}
+			if ((parlen += test[i].cplen) >=
+			    CONCATENATION_PARAGRAPH_LEN) {
+				/* LINE FEED */
+				concatenation[len++] = 0x000A;
+				parlen = 0;
+			}
+		}
+		if (check_segmentation(concatenation, len, index)) {
+			fprintf(stderr,
+			        "%s: %s: Failed concatenated conformance "
+			        "test %zu.\n",
+			        argv0, name, num_tests - testlen);
+			failed++;
+		}
+	}
+	printf("%s: %s: %zu/%zu conformance tests passed.\n", argv0, name,
+	       num_tests - failed, num_tests);
+
+	return (failed > 0) ? 1 : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	(void)argc;
+
+	return run_break_tests(segment_next_character_break,
+	                       character_break_test,
+	                       LEN(character_break_test), argv[0]) +
+	       run_break_tests(segment_next_word_break, word_break_test,
+	                       LEN(word_break_test), argv[0]) +
+	       run_break_tests(segment_next_sentence_break,
+	                       sentence_break_test, LEN(sentence_break_test),
+	                       argv[0]) +
+	       run_segmentation_tests(character_break_test,
+	                              LEN(character_break_test), 0,
+	                              "character segmentation", argv[0]) +
+	       run_segmentation_tests(word_break_test, LEN(word_break_test), 1,
+	                              "word segmentation", argv[0]) +
+	       run_segmentation_tests(sentence_break_test,
+	                              LEN(sentence_break_test), 2,
+	                              "sentence segmentation", argv[0]) +
+	       run_segmentation_tests(line_break_test, LEN(line_break_test), 3,
+	                              "line segmentation", argv[0]) +
+	       run_unit_tests(unit_test_callback_segment_utf8, segment_utf8,
+	                      LEN(segment_utf8), "grapheme_segment_utf8",
+	                      argv[0]);
+}